@@ -131,8 +131,10 @@
 #include <cstdint>
 #include <cstring>
 #include <ctime>
+#include <deque>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <sstream>
@@ -161,6 +163,10 @@
   #include <condition_variable>
 #endif
 
+#if HAS_FUTURE
+  #include <future>
+#endif
+
 #if HAS_STRING_VIEW
   #include <string_view>
 #endif
@@ -224,23 +230,58 @@
 #if DUMP_CREATOR_UNIX
   #include <csignal>
   #include <cstdlib>
+  #include <elf.h> // ELF core file structures for the native core writer
   #include <errno.h>
   #include <fcntl.h>
   #include <fstream> // for std::ofstream in _generateCoreDump()
   #include <grp.h>   // for getgrnam, group membership checks
   #include <limits.h>
+  #include <link.h> // ElfW() native-class ELF type selection
   #include <pthread.h>
+  #include <setjmp.h> // sigsetjmp() recovery point of the crash arena
   #include <signal.h>
+  #include <spawn.h>       // posix_spawn() for the crash helper
+  #include <sys/epoll.h>   // Event loop of the systemd-coredump monitor
+  #include <sys/eventfd.h> // Wakes the systemd-coredump monitor on shutdown
   #include <sys/inotify.h> // For instant systemd-coredump monitoring
+  #include <sys/mman.h>    // mmap() for the preallocated crash arena
   #include <sys/prctl.h>
+  #include <sys/procfs.h> // elf_prstatus / elf_prpsinfo core notes
+  #include <sys/ptrace.h> // Thread registers of a crashed process, read by the crash helper
   #include <sys/resource.h>
-  #include <sys/select.h> // For select() in inotify loop
+  #include <sys/socket.h> // socketpair() to the crash helper
   #include <sys/stat.h>
+  #include <sys/syscall.h> // SYS_gettid, SYS_arch_prctl
   #include <sys/types.h>
+  #include <sys/uio.h>  // process_vm_readv for reading process memory
+  #include <sys/user.h> // user_regs_struct register layout
   #include <sys/wait.h>
+  #include <ucontext.h> // getcontext() register capture
   #include <unistd.h>
 #endif
 
+// Optional compression codecs for UNIX core output (enabled by the build system)
+#ifndef CORE_DUMP_GENERATOR_HAS_ZSTD
+  #define CORE_DUMP_GENERATOR_HAS_ZSTD 0
+#endif
+#ifndef CORE_DUMP_GENERATOR_HAS_LZ4
+  #define CORE_DUMP_GENERATOR_HAS_LZ4 0
+#endif
+
+#if DUMP_CREATOR_UNIX && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+  #include <immintrin.h> // SSE2/AVX2 zero-page detection for sparse cores
+  #define CORE_DUMP_GENERATOR_X86_SIMD 1
+#else
+  #define CORE_DUMP_GENERATOR_X86_SIMD 0
+#endif
+
+#if DUMP_CREATOR_UNIX && CORE_DUMP_GENERATOR_HAS_ZSTD
+  #include <zstd.h>
+#endif
+#if DUMP_CREATOR_UNIX && CORE_DUMP_GENERATOR_HAS_LZ4
+  #include <lz4frame.h>
+#endif
+
 /**
  * @enum DumpType
  * @brief Comprehensive enumeration of all supported crash dump types across
@@ -294,8 +335,12 @@ enum class DumpType : std::int8_t
   KERNEL_AUTOMATIC_DUMP = 23, ///< Автоматический дамп памяти - flexible size
   KERNEL_ACTIVE_DUMP    = 24, ///< Активный дамп памяти - similar to full but smaller
 
-  // UNIX/Linux core dump types
-  CORE_DUMP_FULL = 25, ///< Full core dump with all memory
+  // UNIX/Linux core dump types, ordered by content (see CoreDumpEngine::CaptureEngine)
+  CORE_DUMP_FULL            = 25, ///< Full core dump with all memory
+  CORE_DUMP_STACK_ONLY      = 26, ///< Registers and live thread stacks only
+  CORE_DUMP_STACKS_AND_DATA = 27, ///< Thread stacks plus module .data/.bss
+  CORE_DUMP_HEAP_FILTERED   = 28, ///< Private writable memory, no code or shared mappings
+  CORE_DUMP_COMPRESSED      = 29, ///< Full core dump streamed through zstd/lz4
 
   // Default types
   DEFAULT_WINDOWS = MINI_DUMP_WITH_FULL_MEMORY, ///< Default Windows dump type
@@ -313,14 +358,13 @@ namespace DumpTypeUtils
   namespace Constants
   {
     static constexpr std::int8_t MIN_DUMP_TYPE_VALUE = 0;
-    static constexpr std::int8_t MAX_DUMP_TYPE_VALUE = 25;
+    static constexpr std::int8_t MAX_DUMP_TYPE_VALUE = 29;
     static constexpr std::int8_t AUTO_DETECT_VALUE   = -1;
     static constexpr std::int8_t WINDOWS_MAX_TYPE    = 24;
     static constexpr std::int8_t UNIX_MIN_TYPE       = 25;
-    static constexpr std::int8_t UNIX_MAX_TYPE       = 25;
+    static constexpr std::int8_t UNIX_MAX_TYPE       = 29;
     static constexpr std::int8_t KERNEL_MIN_TYPE     = 20;
     static constexpr std::int8_t KERNEL_MAX_TYPE     = 24;
-    static constexpr std::int8_t KERNEL_ONLY_TYPE    = 26;
   } // namespace Constants
 
   // Character code constants
@@ -386,8 +430,7 @@ namespace DumpTypeUtils
   isKernelType(DumpType type) noexcept
   {
     auto const value = static_cast<std::int8_t>(type);
-    return (value >= Constants::KERNEL_MIN_TYPE && value <= Constants::KERNEL_MAX_TYPE)
-           || (value == Constants::KERNEL_ONLY_TYPE);
+    return value >= Constants::KERNEL_MIN_TYPE && value <= Constants::KERNEL_MAX_TYPE;
   }
 
   /**
@@ -409,7 +452,7 @@ namespace DumpTypeUtils
   constexpr DumpType
   getMaxValue() noexcept
   {
-    return DumpType::CORE_DUMP_FULL;
+    return DumpType::CORE_DUMP_COMPRESSED;
   }
 } // namespace DumpTypeUtils
 
@@ -439,6 +482,335 @@ namespace CoreDumpGeneratorConcepts
 } // namespace CoreDumpGeneratorConcepts
 #endif
 
+/**
+ * @class MemoryFilter
+ * @brief Compiled matcher for DumpConfiguration memory filters (UNIX)
+ *
+ * Each filter string is one rule. The action prefix is optional and
+ * defaults to include. Criteria are comma-separated and must all match:
+ *
+ * @code
+ * rule      := [("include" | "exclude") ":"] criterion ("," criterion)*
+ * criterion := "path=" glob        // pathname column of /proc/self/maps, '*' and '?' wildcards
+ *            | "perms=" [rwxsp]+   // required permissions; 's' shared, 'p' private
+ *            | "anon" | "file"     // anonymous or file-backed mapping
+ *            | "minsize=" size | "maxsize=" size   // size := digits [K|M|G]
+ * @endcode
+ *
+ * Examples: "exclude:path=*.so*", "exclude:anon,minsize=1G",
+ * "include:perms=rw", "include:path=[stack*".
+ *
+ * @details The last matching rule decides. A region that matches no rule is
+ * included, unless the filter contains at least one include rule, in which
+ * case only explicitly included regions are captured. Filters are parsed once
+ * into fixed-size rules, so matching a region performs no parsing and no
+ * allocation.
+ */
+class MemoryFilter
+{
+public:
+  // Permission bits (same layout as CoreDumpEngine::RegionFlags)
+  static constexpr std::uint8_t PERM_READ   = 1U << 0;
+  static constexpr std::uint8_t PERM_WRITE  = 1U << 1;
+  static constexpr std::uint8_t PERM_EXEC   = 1U << 2;
+  static constexpr std::uint8_t PERM_SHARED = 1U << 3;
+
+  enum class Backing : std::uint8_t
+  {
+    ANY  = 0,
+    ANON = 1,
+    FILE = 2
+  };
+
+  struct Rule {
+    bool m_include = true;
+    std::string m_pathGlob; ///< Empty matches any pathname
+    std::uint8_t m_requiredPerms  = 0;
+    std::uint8_t m_forbiddenPerms = 0;
+    Backing m_backing             = Backing::ANY;
+    std::uint64_t m_minSize       = 0;
+    std::uint64_t m_maxSize       = UINT64_MAX;
+  };
+
+  /**
+   * @brief Parse one filter string
+   * @param filter Filter in the grammar described above
+   * @param rule Receives the parsed rule
+   * @return true if the filter is well-formed
+   */
+  static bool parseRule(std::string const &filter, Rule &rule) noexcept;
+
+  /**
+   * @brief Replace the rules with the parsed form of the given filters
+   * @return false if any filter is malformed (the matcher is left empty)
+   */
+  bool compile(std::vector<std::string> const &filters) noexcept;
+
+  /**
+   * @brief Decide whether a mapping is captured
+   * @param pathname Pathname column of the mapping ("" for anonymous)
+   * @param permissions PERM_* bits of the mapping
+   * @param fileBacked Whether the mapping is backed by a file
+   * @param size Mapping size in bytes
+   */
+  bool includes(char const *pathname, std::uint8_t permissions, bool fileBacked, std::uint64_t size) const noexcept;
+
+  bool
+  empty() const noexcept
+  {
+    return m_rules.empty();
+  }
+
+  /**
+   * @brief Match text against a glob with '*' and '?' wildcards
+   */
+  static bool globMatch(char const *pattern, char const *text) noexcept;
+
+private:
+  std::vector<Rule> m_rules;
+  bool m_defaultInclude = true;
+
+  static bool _parseSize(std::string const &value, std::uint64_t &size) noexcept;
+};
+
+// ==================================== MemoryFilter Implementation
+// ==================================== //
+
+inline bool
+MemoryFilter::globMatch(char const *pattern, char const *text) noexcept
+{
+  // Iterative matcher: backtracks only to the most recent '*'
+  char const *starPattern = nullptr;
+  char const *starText    = nullptr;
+  while(*text != '\0')
+  {
+    if(*pattern == '*')
+    {
+      starPattern = ++pattern;
+      starText    = text;
+    }
+    else if(*pattern == '?' || *pattern == *text)
+    {
+      ++pattern;
+      ++text;
+    }
+    else if(starPattern != nullptr)
+    {
+      pattern = starPattern;
+      text    = ++starText;
+    }
+    else
+      return false;
+  }
+  while(*pattern == '*') ++pattern;
+  return *pattern == '\0';
+}
+
+inline bool
+MemoryFilter::_parseSize(std::string const &value, std::uint64_t &size) noexcept
+{
+  if(value.empty()) return false;
+
+  std::uint64_t number = 0;
+  size_t index         = 0;
+  for(; index < value.size() && value[index] >= '0' && value[index] <= '9'; ++index)
+  {
+    if(number > (UINT64_MAX - 9) / 10) return false;
+    number = number * 10 + static_cast<std::uint64_t>(value[index] - '0');
+  }
+  if(index == 0) return false;
+
+  unsigned shift = 0;
+  if(index < value.size())
+  {
+    switch(value[index])
+    {
+      case 'K':
+      case 'k': shift = 10; break;
+      case 'M':
+      case 'm': shift = 20; break;
+      case 'G':
+      case 'g': shift = 30; break;
+      default: return false;
+    }
+    if(++index != value.size()) return false;
+  }
+  if(shift > 0 && number > (UINT64_MAX >> shift)) return false;
+
+  size = number << shift;
+  return true;
+}
+
+inline bool
+MemoryFilter::parseRule(std::string const &filter, Rule &rule) noexcept
+{
+  try
+  {
+    rule = Rule{};
+    if(filter.empty()) return false;
+    namespace Chars = DumpTypeUtils::CharacterConstants;
+    for(char character : filter)
+    {
+      if(character < Chars::CONTROL_CHAR_THRESHOLD || character == Chars::QUOTE_CHAR
+         || character == Chars::LESS_THAN_CHAR || character == Chars::GREATER_THAN_CHAR || character == Chars::PIPE_CHAR)
+        return false;
+    }
+
+    std::string body = filter;
+    if(body.compare(0, 8, "include:") == 0)
+      body.erase(0, 8);
+    else if(body.compare(0, 8, "exclude:") == 0)
+    {
+      rule.m_include = false;
+      body.erase(0, 8);
+    }
+    if(body.empty()) return false;
+
+    size_t start = 0;
+    while(start <= body.size())
+    {
+      size_t end = body.find(',', start);
+      if(end == std::string::npos) end = body.size();
+      std::string const criterion = body.substr(start, end - start);
+      start                       = end + 1;
+
+      if(criterion == "anon")
+        rule.m_backing = Backing::ANON;
+      else if(criterion == "file")
+        rule.m_backing = Backing::FILE;
+      else if(criterion.compare(0, 5, "path=") == 0 && criterion.size() > 5)
+        rule.m_pathGlob = criterion.substr(5);
+      else if(criterion.compare(0, 8, "minsize=") == 0)
+      {
+        if(!_parseSize(criterion.substr(8), rule.m_minSize)) return false;
+      }
+      else if(criterion.compare(0, 8, "maxsize=") == 0)
+      {
+        if(!_parseSize(criterion.substr(8), rule.m_maxSize)) return false;
+      }
+      else if(criterion.compare(0, 6, "perms=") == 0 && criterion.size() > 6)
+      {
+        for(size_t index = 6; index < criterion.size(); ++index)
+        {
+          switch(criterion[index])
+          {
+            case 'r': rule.m_requiredPerms |= PERM_READ; break;
+            case 'w': rule.m_requiredPerms |= PERM_WRITE; break;
+            case 'x': rule.m_requiredPerms |= PERM_EXEC; break;
+            case 's': rule.m_requiredPerms |= PERM_SHARED; break;
+            case 'p': rule.m_forbiddenPerms |= PERM_SHARED; break;
+            default: return false;
+          }
+        }
+      }
+      else
+        return false;
+    }
+
+    return (rule.m_requiredPerms & rule.m_forbiddenPerms) == 0 && rule.m_minSize <= rule.m_maxSize;
+  }
+  catch(...)
+  {
+    return false;
+  }
+}
+
+inline bool
+MemoryFilter::compile(std::vector<std::string> const &filters) noexcept
+{
+  try
+  {
+    std::vector<Rule> rules(filters.size());
+    bool anyInclude = false;
+    for(size_t index = 0; index < filters.size(); ++index)
+    {
+      if(!parseRule(filters[index], rules[index]))
+      {
+        m_rules.clear();
+        m_defaultInclude = true;
+        return false;
+      }
+      anyInclude = anyInclude || rules[index].m_include;
+    }
+
+    m_rules.swap(rules);
+    m_defaultInclude = !anyInclude;
+    return true;
+  }
+  catch(...)
+  {
+    return false;
+  }
+}
+
+inline bool
+MemoryFilter::includes(char const *pathname, std::uint8_t permissions, bool fileBacked,
+                       std::uint64_t size) const noexcept
+{
+  bool included = m_defaultInclude;
+  for(auto const &rule : m_rules)
+  {
+    if((permissions & rule.m_requiredPerms) != rule.m_requiredPerms) continue;
+    if((permissions & rule.m_forbiddenPerms) != 0) continue;
+    if(rule.m_backing == Backing::ANON && fileBacked) continue;
+    if(rule.m_backing == Backing::FILE && !fileBacked) continue;
+    if(size < rule.m_minSize || size > rule.m_maxSize) continue;
+    if(!rule.m_pathGlob.empty() && !globMatch(rule.m_pathGlob.c_str(), pathname)) continue;
+    included = rule.m_include;
+  }
+  return included;
+}
+
+/**
+ * @enum CompressionCodec
+ * @brief Stream compressor applied to UNIX core output when compression is enabled
+ *
+ * Output is written as a sequence of independent fixed-size frames, so the
+ * result can be decompressed with the stock `zstd -d` / `lz4 -d` tools.
+ *
+ * @note A codec is only usable if the library was enabled at build time
+ * (CORE_DUMP_GENERATOR_HAS_ZSTD / CORE_DUMP_GENERATOR_HAS_LZ4)
+ */
+enum class CompressionCodec : std::uint8_t
+{
+  ZSTD = 0, ///< Zstandard (.zst), best ratio per CPU cycle
+  LZ4  = 1  ///< LZ4 frame format (.lz4), fastest compression
+};
+
+/**
+ * @brief Kinds of mappings the kernel writes to the cores it generates itself
+ *
+ * Bits of /proc/<pid>/coredump_filter (see core(5)), combined with
+ * operator|. They only affect kernel-generated cores, e.g. when the
+ * library's own crash dump could not be written or under systemd-coredump;
+ * cores written by this library use memory filters instead.
+ */
+enum class KernelDumpFilter : std::uint32_t
+{
+  NONE              = 0,
+  ANONYMOUS_PRIVATE = 1U << 0, ///< Heap, stacks and other private anonymous memory
+  ANONYMOUS_SHARED  = 1U << 1, ///< Shared anonymous memory and SysV shared memory
+  FILE_PRIVATE      = 1U << 2, ///< Private file mappings (written pages of libraries and files)
+  FILE_SHARED       = 1U << 3, ///< Shared file mappings (e.g. mmap()ed index files)
+  ELF_HEADERS       = 1U << 4, ///< First page of ELF file mappings, lets debuggers identify modules
+  HUGETLB_PRIVATE   = 1U << 5, ///< Private hugetlbfs memory
+  HUGETLB_SHARED    = 1U << 6, ///< Shared hugetlbfs memory
+  KERNEL_DEFAULT    = (1U << 0) | (1U << 1) | (1U << 4) | (1U << 5), ///< Linux default (0x33)
+  ALL               = (1U << 7) - 1 ///< Every bit above
+};
+
+inline constexpr KernelDumpFilter
+operator|(KernelDumpFilter left, KernelDumpFilter right) noexcept
+{
+  return static_cast<KernelDumpFilter>(static_cast<std::uint32_t>(left) | static_cast<std::uint32_t>(right));
+}
+
+inline constexpr KernelDumpFilter
+operator&(KernelDumpFilter left, KernelDumpFilter right) noexcept
+{
+  return static_cast<KernelDumpFilter>(static_cast<std::uint32_t>(left) & static_cast<std::uint32_t>(right));
+}
+
 /**
  * @class DumpConfiguration
  * @brief Comprehensive configuration class for crash dump generation
@@ -549,6 +921,81 @@ public:
   {
     return m_enableSourceInfo;
   }
+  bool
+  isSnapshot() const noexcept
+  {
+    return m_snapshot;
+  }
+  CompressionCodec
+  getCompressionCodec() const noexcept
+  {
+    return m_compressionCodec;
+  }
+  int
+  getCompressionLevel() const noexcept
+  {
+    return m_compressionLevel;
+  }
+  bool
+  isSparse() const noexcept
+  {
+    return m_sparse;
+  }
+  bool
+  isSkipNonResident() const noexcept
+  {
+    return m_skipNonResident;
+  }
+  bool
+  isSampleThreadRegisters() const noexcept
+  {
+    return m_sampleThreadRegisters;
+  }
+  bool
+  isCrashHelper() const noexcept
+  {
+    return m_crashHelper;
+  }
+  std::string const &
+  getCrashHelperPath() const noexcept
+  {
+    return m_crashHelperPath;
+  }
+  std::string const &
+  getCorePatternHelperPath() const noexcept
+  {
+    return m_corePatternHelperPath;
+  }
+  std::chrono::milliseconds
+  getCoalescingWindow() const noexcept
+  {
+    return m_coalescingWindow;
+  }
+  bool
+  isDeferredSetup() const noexcept
+  {
+    return m_deferredSetup;
+  }
+  std::string const &
+  getSystemdCoredumpDirectory() const noexcept
+  {
+    return m_systemdCoredumpDirectory;
+  }
+  bool
+  isDecompressSystemdCores() const noexcept
+  {
+    return m_decompressSystemdCores;
+  }
+  bool
+  hasKernelDumpFilter() const noexcept
+  {
+    return m_kernelDumpFilterSet;
+  }
+  KernelDumpFilter
+  getKernelDumpFilter() const noexcept
+  {
+    return m_kernelDumpFilter;
+  }
 
   // Setters with validation
   bool setType(DumpType type) noexcept;
@@ -620,6 +1067,85 @@ public:
   {
     m_enableSourceInfo = enable;
   }
+  void
+  setSnapshot(bool snapshot) noexcept
+  {
+    m_snapshot = snapshot;
+  }
+  void
+  setCompressionCodec(CompressionCodec codec) noexcept
+  {
+    m_compressionCodec = codec;
+  }
+  bool setCompressionLevel(int level) noexcept;
+  void
+  setSparse(bool sparse) noexcept
+  {
+    m_sparse = sparse;
+  }
+  void
+  setSkipNonResident(bool skip) noexcept
+  {
+    m_skipNonResident = skip;
+  }
+  /**
+   * @brief Signal every other thread during a manual or snapshot dump to record its registers
+   * @details Off by default: the signal interrupts blocking calls (EINTR from epoll_wait(), nanosleep(), timed
+   *          waits) in threads that did not ask for it. Without it other threads contribute only the stack pointer
+   *          published in /proc/self/task/<tid>/syscall. The signal is SIGRTMIN + THREAD_CAPTURE_SIGNAL_OFFSET and is
+   *          only used while nothing else handles it.
+   */
+  void
+  setSampleThreadRegisters(bool enable) noexcept
+  {
+    m_sampleThreadRegisters = enable;
+  }
+  void
+  setCrashHelper(bool enable) noexcept
+  {
+    m_crashHelper = enable;
+  }
+  bool setCrashHelperPath(std::string const &path) noexcept;
+  bool setCorePatternHelperPath(std::string const &path) noexcept;
+  bool setSystemdCoredumpDirectory(std::string const &path) noexcept;
+  /**
+   * @brief Let dump requests with this configuration reuse a dump that finished at most window ago
+   * @details Requests always join an equal dump that is still queued or being written; 0 (default) adds nothing
+   */
+  void
+  setCoalescingWindow(std::chrono::milliseconds window) noexcept
+  {
+    m_coalescingWindow = std::max(window, std::chrono::milliseconds(0));
+  }
+  /**
+   * @brief Let initialize() return once the crash handlers are armed and finish the rest in the background
+   * @details core_pattern negotiation (which may run sudo), systemd-coredump detection and the monitor start
+   *          then complete on a thread; CoreDumpGenerator::waitUntilReady() waits for them. Default: true
+   */
+  void
+  setDeferredSetup(bool deferred) noexcept
+  {
+    m_deferredSetup = deferred;
+  }
+  /**
+   * @brief Decompress cores taken over from systemd-coredump instead of copying the compressed file
+   * @details Only codecs compiled into this library are decompressed; other files are always copied
+   */
+  void
+  setDecompressSystemdCores(bool decompress) noexcept
+  {
+    m_decompressSystemdCores = decompress;
+  }
+  /**
+   * @brief Have initialize() write this filter to /proc/self/coredump_filter (Linux)
+   * @details Without a call the kernel's current filter is left as is
+   */
+  void
+  setKernelDumpFilter(KernelDumpFilter filter) noexcept
+  {
+    m_kernelDumpFilter    = filter & KernelDumpFilter::ALL;
+    m_kernelDumpFilterSet = true;
+  }
 
   // Validation methods
   bool isValid() const noexcept;
@@ -638,6 +1164,21 @@ private:
   std::vector<std::string> m_memoryFilters; ///< Memory region filters (UNIX)
   bool m_enableSymbols    = true;           ///< Enable symbol information
   bool m_enableSourceInfo = true;           ///< Enable source file information
+  bool m_snapshot         = false;          ///< Write from a forked copy-on-write snapshot (UNIX)
+  CompressionCodec m_compressionCodec = CompressionCodec::ZSTD; ///< Codec used when m_compress is set (UNIX)
+  int m_compressionLevel              = 0; ///< Codec level (0 = codec default)
+  bool m_sparse                       = true; ///< Leave all-zero pages as file holes (UNIX, uncompressed)
+  bool m_skipNonResident              = false; ///< Write swapped-out and untouched pages as zeros (Linux)
+  bool m_sampleThreadRegisters        = false; ///< Signal other threads for their registers (Linux)
+  bool m_crashHelper                  = false; ///< Write crash dumps from a pre-spawned helper process (UNIX)
+  std::string m_crashHelperPath; ///< Helper executable (empty = this executable)
+  std::string m_corePatternHelperPath; ///< Pipe helper for kernel cores (empty = kernel writes the file)
+  std::string m_systemdCoredumpDirectory = "/var/lib/systemd/coredump"; ///< Watched when systemd-coredump is active
+  bool m_decompressSystemdCores          = true; ///< Decompress cores taken from systemd-coredump
+  std::chrono::milliseconds m_coalescingWindow{0}; ///< Reuse of finished dumps by equal requests
+  bool m_deferredSetup = true; ///< Finish initialize() on a background thread
+  KernelDumpFilter m_kernelDumpFilter = KernelDumpFilter::KERNEL_DEFAULT; ///< Written at initialize() if set
+  bool m_kernelDumpFilterSet          = false;
 
   // Private validation helpers
   static bool isValidFilename(std::string const &filename) noexcept;
@@ -681,12 +1222,22 @@ DumpConfiguration::setMaxSizeBytes(size_t maxSize) noexcept
 }
 
 inline bool
-DumpConfiguration::addMemoryFilter(std::string const &filter) noexcept
+DumpConfiguration::setCompressionLevel(int level) noexcept
 {
-  if(!isValidMemoryFilter(filter)) return false;
+  // 0 selects the codec default; zstd accepts up to 22, LZ4 clamps above 12
+  if(level < 0 || level > 22) return false;
+  m_compressionLevel = level;
+  return true;
+}
+
+inline bool
+DumpConfiguration::setCrashHelperPath(std::string const &path) noexcept
+{
+  // posix_spawn() runs the helper long after startup, so relative paths are ambiguous
+  if(!path.empty() && path[0] != '/') return false;
   try
   {
-    m_memoryFilters.emplace_back(filter);
+    m_crashHelperPath = path;
     return true;
   }
   catch(...)
@@ -696,19 +1247,65 @@ DumpConfiguration::addMemoryFilter(std::string const &filter) noexcept
 }
 
 inline bool
-DumpConfiguration::isValid() const noexcept
+DumpConfiguration::setCorePatternHelperPath(std::string const &path) noexcept
 {
-  return DumpTypeUtils::isValid(m_type) && isValidFilename(m_filename) && isValidDirectory(m_directory)
-         && std::all_of(m_memoryFilters.begin(), m_memoryFilters.end(),
-                        [](std::string const &filter) { return isValidMemoryFilter(filter); });
+  // The kernel runs the helper with / as working directory
+  if(!path.empty() && path[0] != '/') return false;
+  try
+  {
+    m_corePatternHelperPath = path;
+    return true;
+  }
+  catch(...)
+  {
+    return false;
+  }
 }
 
-inline std::string
-DumpConfiguration::getValidationError() const
+inline bool
+DumpConfiguration::setSystemdCoredumpDirectory(std::string const &path) noexcept
 {
-  if(!DumpTypeUtils::isValid(m_type)) return "Invalid dump type";
-  if(!isValidFilename(m_filename)) return "Invalid filename: contains invalid characters or path separators";
-  if(!isValidDirectory(m_directory))
+  if(path.empty() || path[0] != '/') return false;
+  try
+  {
+    m_systemdCoredumpDirectory = path;
+    return true;
+  }
+  catch(...)
+  {
+    return false;
+  }
+}
+
+inline bool
+DumpConfiguration::addMemoryFilter(std::string const &filter) noexcept
+{
+  if(!isValidMemoryFilter(filter)) return false;
+  try
+  {
+    m_memoryFilters.emplace_back(filter);
+    return true;
+  }
+  catch(...)
+  {
+    return false;
+  }
+}
+
+inline bool
+DumpConfiguration::isValid() const noexcept
+{
+  return DumpTypeUtils::isValid(m_type) && isValidFilename(m_filename) && isValidDirectory(m_directory)
+         && std::all_of(m_memoryFilters.begin(), m_memoryFilters.end(),
+                        [](std::string const &filter) { return isValidMemoryFilter(filter); });
+}
+
+inline std::string
+DumpConfiguration::getValidationError() const
+{
+  if(!DumpTypeUtils::isValid(m_type)) return "Invalid dump type";
+  if(!isValidFilename(m_filename)) return "Invalid filename: contains invalid characters or path separators";
+  if(!isValidDirectory(m_directory))
     return "Invalid directory: contains invalid characters or is not "
            "accessible";
   for(auto const &filter : m_memoryFilters)
@@ -791,36 +1388,9 @@ DumpConfiguration::isValidDirectory(std::string const &directory) noexcept
 inline bool
 DumpConfiguration::isValidMemoryFilter(std::string const &filter) noexcept
 {
-  if(filter.empty()) return false;
-
-// Basic validation for memory filter format
-// This is a simplified validation - in practice, you might want more
-// sophisticated checks
-#if HAS_RANGES
-  return std::ranges::all_of(filter,
-                             [](char character)
-                             {
-                               return character >= DumpTypeUtils::CharacterConstants::CONTROL_CHAR_THRESHOLD
-                                      && character != DumpTypeUtils::CharacterConstants::ASTERISK_CHAR
-                                      && character != DumpTypeUtils::CharacterConstants::QUESTION_CHAR
-                                      && character != DumpTypeUtils::CharacterConstants::QUOTE_CHAR
-                                      && character != DumpTypeUtils::CharacterConstants::LESS_THAN_CHAR
-                                      && character != DumpTypeUtils::CharacterConstants::GREATER_THAN_CHAR
-                                      && character != DumpTypeUtils::CharacterConstants::PIPE_CHAR;
-                             });
-#else
-  return std::all_of(filter.begin(), filter.end(),
-                     [](char character)
-                     {
-                       return character >= DumpTypeUtils::CharacterConstants::CONTROL_CHAR_THRESHOLD
-                              && character != DumpTypeUtils::CharacterConstants::ASTERISK_CHAR
-                              && character != DumpTypeUtils::CharacterConstants::QUESTION_CHAR
-                              && character != DumpTypeUtils::CharacterConstants::QUOTE_CHAR
-                              && character != DumpTypeUtils::CharacterConstants::LESS_THAN_CHAR
-                              && character != DumpTypeUtils::CharacterConstants::GREATER_THAN_CHAR
-                              && character != DumpTypeUtils::CharacterConstants::PIPE_CHAR;
-                     });
-#endif
+  // Filters must follow the MemoryFilter grammar
+  MemoryFilter::Rule rule;
+  return MemoryFilter::parseRule(filter, rule);
 }
 
 inline bool
@@ -831,7 +1401,17 @@ DumpConfiguration::operator==(DumpConfiguration const &other) const noexcept
          && m_includeHandleData == other.m_includeHandleData && m_includeThreadInfo == other.m_includeThreadInfo
          && m_includeProcessData == other.m_includeProcessData && m_maxSizeBytes == other.m_maxSizeBytes
          && m_memoryFilters == other.m_memoryFilters && m_enableSymbols == other.m_enableSymbols
-         && m_enableSourceInfo == other.m_enableSourceInfo;
+         && m_enableSourceInfo == other.m_enableSourceInfo && m_snapshot == other.m_snapshot
+         && m_compressionCodec == other.m_compressionCodec && m_compressionLevel == other.m_compressionLevel
+         && m_sparse == other.m_sparse && m_skipNonResident == other.m_skipNonResident
+         && m_sampleThreadRegisters == other.m_sampleThreadRegisters
+         && m_crashHelper == other.m_crashHelper
+         && m_crashHelperPath == other.m_crashHelperPath && m_corePatternHelperPath == other.m_corePatternHelperPath
+         && m_systemdCoredumpDirectory == other.m_systemdCoredumpDirectory
+         && m_decompressSystemdCores == other.m_decompressSystemdCores && m_coalescingWindow == other.m_coalescingWindow
+         && m_deferredSetup == other.m_deferredSetup
+         && m_kernelDumpFilterSet == other.m_kernelDumpFilterSet
+         && m_kernelDumpFilter == other.m_kernelDumpFilter;
 }
 
 inline bool
@@ -948,144 +1528,4059 @@ private:
   static std::map<DumpType, bool> const s_platformSupport;
 };
 
+#if DUMP_CREATOR_UNIX
 /**
- * @class CoreDumpGenerator
- * @brief Cross-platform crash dump handler with comprehensive debugging support
- *
- * This class provides a robust, thread-safe crash dump handler that
- * automatically captures memory dumps when crashes occur on both Windows and
- * UNIX platforms. It supports multiple dump types through the DumpFactory
- * pattern and provides comprehensive debugging information for post-mortem
- * analysis.
- *
- * @details The CoreDumpGenerator offers:
- * - Automatic crash detection and dump generation
- * - Cross-platform compatibility (Windows/UNIX)
- * - Multiple dump types and configurations
- * - Thread-safe singleton pattern implementation
- * - Comprehensive error handling and logging
- * - Security-focused path validation
- * - Atomic file operations to prevent race conditions
- *
- * @invariant The singleton instance is created only once and is thread-safe
- * @invariant All file operations are atomic to prevent TOCTOU race conditions
- * @invariant All input paths are validated for security vulnerabilities
- * @invariant Platform-specific handlers are properly initialized
- *
- * @thread_safety This class is thread-safe. Multiple threads can call
- * public methods concurrently without external synchronization.
- *
- * @exception_safety All public methods provide strong exception safety
- * guarantee unless otherwise specified. Methods marked noexcept provide
- * no-throw guarantee.
+ * @namespace CoreDumpEngine
+ * @brief Native ELF core writer used by the UNIX dump path
  *
- * @since Version 1.0
- * @see DumpType
- * @see DumpConfiguration
- * @see DumpFactory
+ * The engine walks /proc/<pid>/maps and streams a gdb-loadable ELF core file
+ * (one PT_NOTE segment followed by one PT_LOAD segment per mapping) straight
+ * to a file descriptor. It replaces the gcore/gdb shell-outs: no debugger is
+ * attached, the process is never stopped and no elevated privileges are
+ * required.
  *
- * @example
- * ```cpp
- * // Initialize the crash dump handler
- * CoreDumpGenerator::initialize("/path/to/dumps",
- * DumpType::MINI_DUMP_WITH_FULL_MEMORY);
+ * @details The writer emits the same notes as the Linux kernel core dumper:
+ * - NT_PRSTATUS / NT_FPREGSET for every captured thread
+ * - NT_PRPSINFO with the command name and arguments
+ * - NT_AUXV with the process auxiliary vector
+ * - NT_FILE with the file-backed mapping table
  *
- * // Generate a manual dump
- * CoreDumpGenerator::generateDump("Manual dump for testing");
+ * @note The engine never logs; callers receive statistics and decide what to
+ * report.
  *
- * // Get the singleton instance
- * auto& generator = CoreDumpGenerator::instance();
- * ```
+ * @see core(5), elf(5), proc(5)
  */
-class CoreDumpGenerator
+namespace CoreDumpEngine
 {
-public:
-  static constexpr size_t const KB_32                     = 32ULL * 1024ULL;   // 32KB
-  static constexpr size_t const KB_64                     = 64ULL * 1024ULL;   // 64KB
-  static constexpr size_t const KB_128                    = 128ULL * 1024ULL;  // 128KB
-  static constexpr size_t const KB_256                    = 256ULL * 1024ULL;  // 256KB
-  static constexpr size_t const KB_512                    = 512ULL * 1024ULL;  // 512KB
-  static constexpr size_t const MB_1                      = 1024ULL * 1024ULL; // 1MB
+  namespace Constants
+  {
+    static constexpr size_t COPY_CHUNK_SIZE     = 1024ULL * 1024ULL; ///< Memory copy granularity (1MB)
+    static constexpr size_t READ_BATCH_IOVECS   = 512;               ///< Region pieces per process_vm_readv()
+    static constexpr size_t INITIAL_PROC_BUFFER = 64ULL * 1024ULL;   ///< Initial /proc read buffer (64KB)
+    static constexpr size_t NOTE_ALIGNMENT      = 4;                 ///< ELF note field alignment
+    static constexpr size_t COMPRESSION_FRAME   = 4ULL * 1024ULL * 1024ULL; ///< Uncompressed bytes per frame (4MB)
+    static constexpr char const *NOTE_NAME_CORE = "CORE";            ///< Owner name of kernel-style notes
+    static constexpr char const *NOTE_NAME_CDGEN = "CDGEN"; ///< Owner name of CoreDumpGenerator notes
+    static constexpr std::uint32_t NT_CDGEN_DROPPED_REGIONS = 0x43440001U; ///< Ranges left out by the budget planner
+    static constexpr std::uint32_t DROPPED_REGIONS_VERSION  = 1;           ///< Layout version of that note
+    static constexpr std::uint32_t NT_CDGEN_CRASH_RECORD    = 0x43440002U; ///< CrashRecord of a crash dump
+    static constexpr std::uint32_t CRASH_RECORD_VERSION     = 1;           ///< Layout version of CrashRecord
+    static constexpr char const *CRASH_RECORD_EXTENSION     = ".crashinfo"; ///< Sidecar file next to a crash core
+    static constexpr std::uint32_t NT_CDGEN_NON_RESIDENT    = 0x43440003U; ///< Pages written as zeros, not read
+    static constexpr std::uint32_t NON_RESIDENT_VERSION     = 1;           ///< Layout version of that note
+    static constexpr size_t MAX_NON_RESIDENT_RANGES = 65536; ///< Further non-resident pages are read normally
+    static constexpr size_t PAGEMAP_BATCH_PAGES     = 512;   ///< /proc/<pid>/pagemap entries per pread()
+    static constexpr std::uint32_t NT_CDGEN_EXCLUDED_REGIONS = 0x43440004U; ///< Ranges from excludeRegion()
+    static constexpr std::uint32_t EXCLUDED_REGIONS_VERSION  = 1;           ///< Layout version of that note
+    static constexpr size_t MAX_EXCLUDED_REGIONS = 1024; ///< Slots of the runtime exclusion registry
+    static constexpr size_t REGION_LABEL_SIZE    = 32;   ///< Label bytes kept per excluded range
+    static constexpr size_t STACK_RED_ZONE        = 128;             ///< Bytes below SP that may hold live data
+    static constexpr size_t HEAP_WINDOW           = 64ULL * 1024ULL; ///< Captured window around register values
+    static constexpr size_t BUDGET_HEADER_RESERVE = 64ULL * 1024ULL; ///< Fixed headroom for headers and notes
+    static constexpr int THREAD_CAPTURE_SIGNAL_OFFSET = 4; ///< Register capture signal is SIGRTMIN + offset
+    static constexpr std::chrono::milliseconds THREAD_CAPTURE_TIMEOUT{50}; ///< Wait for threads to answer
+    static constexpr size_t CRASH_ARENA_SIZE = 16ULL * 1024ULL * 1024ULL; ///< Crash-path scratch memory (16MB)
+    static constexpr size_t ALT_STACK_SIZE      = 128ULL * 1024ULL; ///< Alternate signal stack per thread
+    static constexpr size_t ALT_STACK_POOL_SIZE = 32;               ///< Preallocated alternate stacks (<= 64)
+    static constexpr size_t OVERFLOW_INNER_BYTES = 256ULL * 1024ULL; ///< Innermost frames kept on stack overflow
+    static constexpr size_t OVERFLOW_OUTER_BYTES = 64ULL * 1024ULL;  ///< Outermost frames kept on stack overflow
+    static constexpr size_t OVERFLOW_GUARD_GAP = 1024ULL * 1024ULL; ///< Max fault distance below an overflowed stack
+    static constexpr char const *CRASH_HELPER_ARGUMENT = "--core-dump-generator-helper"; ///< argv[1] of the helper
+    static constexpr int CRASH_HELPER_FD                = 3; ///< Helper end of the socketpair in the helper process
+    static constexpr std::uint32_t CRASH_HELPER_VERSION = 2; ///< Layout version of the helper messages
+    static constexpr int CRASH_HELPER_START_SECONDS     = 5;  ///< Longest wait for the helper to start
+    static constexpr int CRASH_HELPER_STALL_SECONDS     = 30; ///< Longest a crash waits for the helper to write
+    static constexpr unsigned CRASH_HELPER_RESTARTS     = 3;  ///< Helpers started again after dying
+    static constexpr size_t CORE_PATTERN_MAX_LENGTH = 127; ///< Longest core_pattern the kernel accepts
+    static constexpr size_t CORE_PIPE_SIZE = 1024ULL * 1024ULL; ///< Requested size of the pipe a piped core arrives on
+    static constexpr size_t SYSTEMD_EXTRACTION_WORKERS = 4; ///< Most systemd-coredump files extracted at once
+    static constexpr size_t SYSTEMD_RECENT_CORES = 64; ///< Queued core names remembered to ignore repeated events
+  } // namespace Constants
 
-  CoreDumpGenerator(CoreDumpGenerator const &)            = delete;
-  CoreDumpGenerator &operator=(CoreDumpGenerator const &) = delete;
-  CoreDumpGenerator(CoreDumpGenerator &&)                 = delete;
-  CoreDumpGenerator &operator=(CoreDumpGenerator &&)      = delete;
-  ~CoreDumpGenerator() noexcept
+  namespace RegionFlags
   {
-#if DUMP_CREATOR_UNIX
-    // Stop instant systemd monitor thread
-    if(s_monitorThread.joinable())
-    {
-      s_monitorThreadShouldStop.store(true, std::memory_order_release);
-      s_monitorThread.join();
-    }
+    static constexpr std::uint8_t READ   = MemoryFilter::PERM_READ;
+    static constexpr std::uint8_t WRITE  = MemoryFilter::PERM_WRITE;
+    static constexpr std::uint8_t EXEC   = MemoryFilter::PERM_EXEC;
+    static constexpr std::uint8_t SHARED = MemoryFilter::PERM_SHARED;
+  } // namespace RegionFlags
 
-    // Restore original core pattern on destruction
-    _restoreCorePattern();
-#endif
+  /**
+   * @brief Current kernel thread id
+   */
+  inline pid_t
+  currentThreadId() noexcept
+  {
+    return static_cast<pid_t>(syscall(SYS_gettid));
   }
 
   /**
-   * @brief Initialize the crash dump handler
-   *
-   * Sets up platform-specific crash handlers with default configuration.
-   * Also sets up C++ exception handling.
+   * @class CrashArena
+   * @brief Preallocated bump allocator backing engine containers on the crash path
    *
-   * @param dumpDirectory Optional directory path for dump files.
-   *                      If empty, uses executable directory.
-   * @param dumpType Type of dump to generate (defaults to platform-specific)
-   * @param handleExceptions Whether to handle unhandled C++ exceptions
-   * (default: true)
-   * @throws std::runtime_error if initialization fails
-   * @throws std::system_error if filesystem operations fail
-   * @throws std::invalid_argument if configuration is invalid
+   * The arena is mapped once by CoreDumpGenerator::initialize(). While a
+   * thread holds it (see ArenaScope), every ArenaAllocator used on that
+   * thread carves memory out of the mapping, so writing a crash dump never
+   * enters malloc, which may be the code that crashed or may hold a lock.
+   * Deallocation is a no-op; the arena is rewound as a whole on release.
+   * Requests beyond the arena are served by mmap() and never returned; if
+   * that fails too, the holder resumes at its recovery point (see abandon()).
    *
-   * @complexity O(1) for basic initialization, O(n) where n is directory depth
-   * for recursive creation
-   * @thread_safety This function is thread-safe and may be called concurrently
-   * @exception_safety Strong guarantee: if an exception is thrown, the object
-   * remains in a valid state
+   * @note Constant-initialized and never destroyed, so it is usable from
+   * signal handlers at any point of the process lifetime
    */
-  static void initialize(std::string const &dumpDirectory = "", DumpType dumpType = DumpType::DEFAULT_AUTO,
-                         bool handleExceptions = true);
+  class CrashArena
+  {
+  public:
+    constexpr CrashArena() noexcept = default;
+    CrashArena(CrashArena const &)            = delete;
+    CrashArena &operator=(CrashArena const &) = delete;
+
+    /**
+     * @brief Process-wide arena instance
+     */
+    static CrashArena &
+    instance() noexcept
+    {
+      static CrashArena arena;
+      return arena;
+    }
+
+    /**
+     * @brief Map the arena (idempotent)
+     * @param size Arena size in bytes; pages are committed on first use
+     * @return false if the mapping failed
+     */
+    bool
+    reserve(size_t size) noexcept
+    {
+      if(m_base.load(std::memory_order_acquire) != nullptr) return true;
+      void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      if(memory == MAP_FAILED) return false;
+      madvise(memory, size, MADV_DONTDUMP); // Scratch memory is never worth dumping
+
+      char *expected = nullptr;
+      m_size         = size;
+      if(!m_base.compare_exchange_strong(expected, static_cast<char *>(memory), std::memory_order_acq_rel))
+        munmap(memory, size); // Lost the race against another initializer
+      return true;
+    }
+
+    /**
+     * @brief Bind the arena to the calling thread
+     * @param recovery Where abandon() resumes; must stay valid until release()
+     * @return false if the arena is not reserved or held by another thread
+     */
+    bool
+    acquire(sigjmp_buf &recovery) noexcept
+    {
+      pid_t expected = 0;
+      if(m_base.load(std::memory_order_acquire) == nullptr
+         || !m_owner.compare_exchange_strong(expected, currentThreadId(), std::memory_order_acquire))
+        return false;
+      m_used     = 0;
+      m_recovery = &recovery;
+      return true;
+    }
+
+    /**
+     * @brief Rewind the arena and unbind it
+     */
+    void
+    release() noexcept
+    {
+      m_used     = 0;
+      m_recovery = nullptr;
+      m_owner.store(0, std::memory_order_release);
+    }
+
+    /**
+     * @brief Resume the holder at its recovery point after an allocation failure
+     * @details Stands in for throwing std::bad_alloc, whose exception object
+     * would be allocated with malloc. The frames in between are dropped
+     * without running destructors: on the crash path they only own arena
+     * memory, which release() rewinds, and descriptors and configuration
+     * readers of a process that is about to die.
+     */
+    [[noreturn]] void
+    abandon() noexcept
+    {
+      siglongjmp(*m_recovery, 1);
+    }
+
+    /**
+     * @brief Whether the calling thread currently holds the arena
+     * @note A single relaxed load when the arena is free
+     */
+    bool
+    isHeldByCaller() const noexcept
+    {
+      pid_t const owner = m_owner.load(std::memory_order_relaxed);
+      return owner != 0 && owner == currentThreadId();
+    }
+
+    /**
+     * @brief Carve an aligned block out of the arena
+     * @return nullptr if neither the arena nor mmap() can satisfy the request
+     */
+    void *
+    allocate(size_t size, size_t alignment) noexcept
+    {
+      size_t const start = (m_used + alignment - 1) & ~(alignment - 1);
+      if(start <= m_size && size <= m_size - start)
+      {
+        m_used = start + size;
+        return m_base.load(std::memory_order_relaxed) + start;
+      }
+      void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      return memory == MAP_FAILED ? nullptr : memory;
+    }
+
+    /**
+     * @brief Whether a block lies inside the arena mapping
+     */
+    bool
+    owns(void const *pointer) const noexcept
+    {
+      char const *base = m_base.load(std::memory_order_acquire);
+      auto const *byte = static_cast<char const *>(pointer);
+      return base != nullptr && byte >= base && byte < base + m_size;
+    }
+
+    /**
+     * @brief Start of the arena mapping, nullptr until reserve() succeeded
+     */
+    void const *
+    base() const noexcept
+    {
+      return m_base.load(std::memory_order_acquire);
+    }
+
+    size_t
+    size() const noexcept
+    {
+      return m_size;
+    }
+
+  private:
+    std::atomic<char *> m_base{nullptr};
+    std::atomic<pid_t> m_owner{0}; ///< Kernel thread id of the holder, 0 when free
+    size_t m_size          = 0;
+    size_t m_used          = 0;       ///< Only touched by the holder
+    sigjmp_buf *m_recovery = nullptr; ///< Set by the holder in acquire()
+  };
 
   /**
-   * @brief Initialize the crash dump handler with full configuration
-   *
-   * Sets up platform-specific crash handlers with custom configuration.
-   * Also sets up C++ exception handling.
-   *
-   * @param config Complete dump configuration
-   * @param handleExceptions Whether to handle unhandled C++ exceptions
-   * (default: true)
-   * @throws std::runtime_error if initialization fails
-   * @throws std::system_error if filesystem operations fail
+   * @brief RAII holder of the crash arena
    */
-  static void initialize(DumpConfiguration const &config, bool handleExceptions = true);
+  class ArenaScope
+  {
+  public:
+    explicit ArenaScope(sigjmp_buf &recovery) noexcept : m_acquired(CrashArena::instance().acquire(recovery)) {}
+    ~ArenaScope() noexcept
+    {
+      if(m_acquired) CrashArena::instance().release();
+    }
+    ArenaScope(ArenaScope const &)            = delete;
+    ArenaScope &operator=(ArenaScope const &) = delete;
+
+    bool
+    isAcquired() const noexcept
+    {
+      return m_acquired;
+    }
+
+  private:
+    bool m_acquired;
+  };
 
   /**
-   * @brief Check if the dump creator is initialized
-   *
-   * @return true if initialized, false otherwise
+   * @brief Standard allocator that draws from the crash arena on the thread holding it
+   * @details Behaves like std::allocator everywhere else. While the arena is
+   * held, nothing is ever passed to operator delete, so blocks from either
+   * source can be released safely.
    */
-  static bool isInitialized() noexcept;
+  template<typename T>
+  struct ArenaAllocator {
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+    template<typename U>
+    ArenaAllocator(ArenaAllocator<U> const &) noexcept
+    {}
+
+    T *
+    allocate(size_t count)
+    {
+      CrashArena &arena = CrashArena::instance();
+      if(!arena.isHeldByCaller()) return static_cast<T *>(::operator new(count * sizeof(T)));
+
+      void *memory = arena.allocate(count * sizeof(T), alignof(T));
+      if(memory == nullptr) arena.abandon(); // Throwing would allocate the exception with malloc
+      return static_cast<T *>(memory);
+    }
+
+    void
+    deallocate(T *pointer, size_t) noexcept
+    {
+      CrashArena &arena = CrashArena::instance();
+      if(!arena.owns(pointer) && !arena.isHeldByCaller()) ::operator delete(pointer);
+    }
+  };
+
+  template<typename T, typename U>
+  inline bool
+  operator==(ArenaAllocator<T> const &, ArenaAllocator<U> const &) noexcept
+  {
+    return true;
+  }
+
+  template<typename T, typename U>
+  inline bool
+  operator!=(ArenaAllocator<T> const &, ArenaAllocator<U> const &) noexcept
+  {
+    return false;
+  }
+
+  template<typename T>
+  using ArenaVector = std::vector<T, ArenaAllocator<T>>;
 
   /**
-   * @brief Manually trigger a dump generation
-   *
-   * @param reason Optional reason for the dump generation
-   * @param dumpType Type of dump to generate (uses current config if
-   * DEFAULT_AUTO)
-   * @return true if dump was generated successfully, false otherwise
-   * @throws std::runtime_error if not initialized
-   * @throws std::system_error if filesystem operations fail
-   * @throws std::invalid_argument if dump type is not supported
+   * @class AltStackPool
+   * @brief Preallocated, guarded alternate signal stacks
    *
-   * @complexity O(1) for basic operations, O(n) where n is memory size for full
-   * dumps
-   * @thread_safety This function is thread-safe and may be called concurrently
-   * @exception_safety Basic guarantee: if an exception is thrown, the system
+   * All pooled stacks live in one mapping reserved by initialize(); each has
+   * a PROT_NONE guard page below it, so a handler that overflows its
+   * alternate stack faults instead of corrupting memory. Leasing a stack is
+   * a lock-free bit claim, so registering a thread costs no mmap() unless the
+   * pool is exhausted.
+   */
+  class AltStackPool
+  {
+  public:
+    constexpr AltStackPool() noexcept = default;
+    AltStackPool(AltStackPool const &)            = delete;
+    AltStackPool &operator=(AltStackPool const &) = delete;
+
+    /**
+     * @brief Process-wide pool instance
+     */
+    static AltStackPool &
+    instance() noexcept
+    {
+      static AltStackPool pool;
+      return pool;
+    }
+
+    /**
+     * @brief Map the pooled stacks (idempotent)
+     * @return false if the mapping failed; acquire() then maps stacks one by one
+     */
+    bool
+    reserve() noexcept
+    {
+      if(m_base.load(std::memory_order_acquire) != nullptr) return true;
+      size_t const total = Constants::ALT_STACK_POOL_SIZE * _slotSize();
+      void *memory = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      if(memory == MAP_FAILED) return false;
+      madvise(memory, total, MADV_DONTDUMP);
+      for(size_t slot = 0; slot < Constants::ALT_STACK_POOL_SIZE; ++slot)
+        mprotect(static_cast<char *>(memory) + slot * _slotSize(), _guardSize(), PROT_NONE);
+
+      char *expected = nullptr;
+      if(!m_base.compare_exchange_strong(expected, static_cast<char *>(memory), std::memory_order_acq_rel))
+        munmap(memory, total);
+      return true;
+    }
+
+    /**
+     * @brief Lease a stack of Constants::ALT_STACK_SIZE bytes
+     * @return Lowest usable address, nullptr if no stack could be provided
+     */
+    void *
+    acquire() noexcept
+    {
+      char *const base = m_base.load(std::memory_order_acquire);
+      std::uint64_t used = m_used.load(std::memory_order_relaxed);
+      while(base != nullptr)
+      {
+        size_t slot = 0;
+        while(slot < Constants::ALT_STACK_POOL_SIZE && (used & (1ULL << slot)) != 0) ++slot;
+        if(slot == Constants::ALT_STACK_POOL_SIZE) break;
+        if(m_used.compare_exchange_weak(used, used | (1ULL << slot), std::memory_order_acquire))
+          return base + slot * _slotSize() + _guardSize();
+      }
+
+      // Pool exhausted (or never reserved): map a private guarded stack
+      void *memory = mmap(nullptr, _slotSize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if(memory == MAP_FAILED) return nullptr;
+      madvise(memory, _slotSize(), MADV_DONTDUMP);
+      mprotect(memory, _guardSize(), PROT_NONE);
+      return static_cast<char *>(memory) + _guardSize();
+    }
+
+    /**
+     * @brief Return a stack obtained from acquire()
+     */
+    void
+    release(void *stack) noexcept
+    {
+      char *const base = m_base.load(std::memory_order_acquire);
+      char *const slotStart = static_cast<char *>(stack) - _guardSize();
+      if(base != nullptr && slotStart >= base && slotStart < base + Constants::ALT_STACK_POOL_SIZE * _slotSize())
+      {
+        m_used.fetch_and(~(1ULL << static_cast<size_t>((slotStart - base) / _slotSize())), std::memory_order_release);
+        return;
+      }
+      munmap(slotStart, _slotSize());
+    }
+
+  private:
+    static_assert(Constants::ALT_STACK_POOL_SIZE <= 64, "pool occupancy is tracked in one 64-bit mask");
+
+    std::atomic<char *> m_base{nullptr};
+    std::atomic<std::uint64_t> m_used{0}; ///< Bit per leased pool slot
+
+    static size_t
+    _guardSize() noexcept
+    {
+      return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+    static size_t
+    _slotSize() noexcept
+    {
+      return _guardSize() + Constants::ALT_STACK_SIZE;
+    }
+  };
+
+  /**
+   * @brief Alternate stack leased by the current thread, returned when the thread exits
+   */
+  class AltStackLease
+  {
+  public:
+    AltStackLease() noexcept = default;
+    ~AltStackLease() noexcept
+    {
+      uninstall();
+    }
+    AltStackLease(AltStackLease const &)            = delete;
+    AltStackLease &operator=(AltStackLease const &) = delete;
+
+    /**
+     * @brief Install a pooled alternate stack unless the thread already has one
+     * @return true if the thread has an alternate stack afterwards
+     */
+    bool
+    install() noexcept
+    {
+      stack_t current;
+      if(sigaltstack(nullptr, &current) == 0 && (current.ss_flags & SS_DISABLE) == 0) return true;
+
+      void *memory = AltStackPool::instance().acquire();
+      if(memory == nullptr) return false;
+
+      stack_t stack;
+      stack.ss_sp    = memory;
+      stack.ss_size  = Constants::ALT_STACK_SIZE;
+      stack.ss_flags = 0;
+      if(sigaltstack(&stack, nullptr) != 0)
+      {
+        AltStackPool::instance().release(memory);
+        return false;
+      }
+      m_stack = memory;
+      return true;
+    }
+
+    /**
+     * @brief Disable and return the leased stack (no-op if it is not ours)
+     */
+    void
+    uninstall() noexcept
+    {
+      if(m_stack == nullptr) return;
+      stack_t current;
+      if(sigaltstack(nullptr, &current) != 0 || (current.ss_flags & SS_ONSTACK) != 0) return; // Still in use
+      if(current.ss_sp == m_stack)
+      {
+        stack_t disabled;
+        std::memset(&disabled, 0, sizeof(disabled));
+        disabled.ss_flags = SS_DISABLE;
+        sigaltstack(&disabled, nullptr);
+      }
+      AltStackPool::instance().release(m_stack);
+      m_stack = nullptr;
+    }
+
+    /**
+     * @brief Lease of the calling thread
+     */
+    static AltStackLease &
+    current() noexcept
+    {
+      static thread_local AltStackLease lease;
+      return lease;
+    }
+
+  private:
+    void *m_stack = nullptr;
+  };
+
+  /**
+   * @brief Whole pages inside [address, address + size)
+   * @return false if the range holds no whole page
+   */
+  inline bool
+  wholePages(void const *address, size_t size, std::uintptr_t &start, std::uintptr_t &end) noexcept
+  {
+    std::uintptr_t const pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    std::uintptr_t const first    = reinterpret_cast<std::uintptr_t>(address);
+    if(size > std::numeric_limits<std::uintptr_t>::max() - first) return false;
+    start = (first + pageSize - 1) & ~(pageSize - 1);
+    end   = (first + size) & ~(pageSize - 1);
+    return start < end;
+  }
+
+  /**
+   * @brief Range excluded from dumps at runtime, with the caller's label
+   * @note Layout of the entries of the NT_CDGEN_EXCLUDED_REGIONS note
+   */
+  struct ExcludedRegion {
+    std::uint64_t m_start = 0;
+    std::uint64_t m_end   = 0;
+    char m_label[Constants::REGION_LABEL_SIZE]{}; ///< NUL-terminated, truncated
+  };
+
+  /**
+   * @class ExclusionRegistry
+   * @brief Lock-free table of ranges that dumps written by this library leave out
+   *
+   * Backs CoreDumpGenerator::excludeRegion(). Slots are claimed with a single
+   * compare-and-swap starting at a rotating hint, so registering a range is
+   * cheap enough for allocator hooks and never allocates. Writers hold a slot
+   * BUSY while they change it; each release bumps the slot's generation, so
+   * readers detect a copy that raced with a change (seqlock style). The table
+   * has a fixed layout so the crash helper can copy it out of the crashed
+   * process with process_vm_readv() (see readRemote()).
+   *
+   * @note Constant-initialized and never destroyed, so it is usable from
+   * signal handlers at any point of the process lifetime
+   */
+  class ExclusionRegistry
+  {
+  public:
+    constexpr ExclusionRegistry() noexcept = default;
+    ExclusionRegistry(ExclusionRegistry const &)            = delete;
+    ExclusionRegistry &operator=(ExclusionRegistry const &) = delete;
+
+    /**
+     * @brief Process-wide registry instance
+     */
+    static ExclusionRegistry &
+    instance() noexcept
+    {
+      static ExclusionRegistry registry;
+      return registry;
+    }
+
+    /**
+     * @brief Record [start, end)
+     * @param label Copied and truncated; may be nullptr
+     * @return false if every slot is in use
+     */
+    bool
+    add(std::uintptr_t start, std::uintptr_t end, char const *label) noexcept
+    {
+      size_t const hint = m_hint.load(std::memory_order_relaxed);
+      for(size_t probe = 0; probe < Constants::MAX_EXCLUDED_REGIONS; ++probe)
+      {
+        size_t const index = (hint + probe) % Constants::MAX_EXCLUDED_REGIONS;
+        Slot &slot         = m_slots[index];
+        std::uint32_t const state = slot.m_state.load(std::memory_order_relaxed);
+        if(!_claim(slot, state, FREE)) continue;
+
+        ExcludedRegion &region = slot.m_region;
+        region.m_start         = start;
+        region.m_end           = end;
+        size_t length          = 0;
+        while(label != nullptr && label[length] != '\0' && length + 1 < sizeof(region.m_label))
+        {
+          region.m_label[length] = label[length];
+          ++length;
+        }
+        region.m_label[length] = '\0';
+
+        size_t used = m_used.load(std::memory_order_relaxed);
+        while(used <= index && !m_used.compare_exchange_weak(used, index + 1, std::memory_order_relaxed)) {}
+        _release(slot, state, ACTIVE);
+        m_hint.store(index + 1, std::memory_order_relaxed);
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * @brief Stop excluding [start, end); entries that straddle it are trimmed or split
+     * @return false if a split entry could not keep its upper part (registry full)
+     */
+    bool
+    remove(std::uintptr_t start, std::uintptr_t end) noexcept
+    {
+      bool complete     = true;
+      size_t const used = m_used.load(std::memory_order_acquire);
+      for(size_t index = 0; index < used; ++index)
+      {
+        Slot &slot                = m_slots[index];
+        std::uint32_t const state = slot.m_state.load(std::memory_order_relaxed);
+        if(!_claim(slot, state, ACTIVE)) continue;
+
+        ExcludedRegion &region = slot.m_region;
+        if(region.m_end <= start || region.m_start >= end)
+        {
+          _release(slot, state, ACTIVE);
+          continue;
+        }
+        if(region.m_start >= start && region.m_end <= end)
+        {
+          _release(slot, state, FREE);
+          continue;
+        }
+        if(region.m_start < start && region.m_end > end)
+          complete = add(end, static_cast<std::uintptr_t>(region.m_end), region.m_label) && complete;
+        if(region.m_start < start)
+          region.m_end = start;
+        else
+          region.m_start = end;
+        _release(slot, state, ACTIVE);
+      }
+      return complete;
+    }
+
+    /**
+     * @brief Copy the active entries
+     */
+    void
+    snapshot(ArenaVector<ExcludedRegion> &regions) const
+    {
+      size_t const used = m_used.load(std::memory_order_acquire);
+      for(size_t index = 0; index < used; ++index)
+      {
+        std::uint32_t const state = m_slots[index].m_state.load(std::memory_order_acquire);
+        if((state & STATE_MASK) != ACTIVE) continue;
+        ExcludedRegion const region = m_slots[index].m_region;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(m_slots[index].m_state.load(std::memory_order_relaxed) == state) regions.push_back(region);
+      }
+    }
+
+    /**
+     * @brief Copy the active entries of the registry of another process
+     * @param address Address of that process's instance()
+     * @return false if its memory could not be read
+     * @note The target's threads must be stopped for a consistent copy
+     */
+    static bool
+    readRemote(pid_t pid, std::uint64_t address, ArenaVector<ExcludedRegion> &regions)
+    {
+      static_assert(alignof(ExclusionRegistry) <= alignof(std::uint64_t), "copy buffer alignment");
+      ArenaVector<std::uint64_t> copy((sizeof(ExclusionRegistry) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+      struct iovec local  = {copy.data(), sizeof(ExclusionRegistry)};
+      struct iovec remote = {reinterpret_cast<void *>(static_cast<std::uintptr_t>(address)), local.iov_len};
+      if(process_vm_readv(pid, &local, 1, &remote, 1, 0) != static_cast<ssize_t>(local.iov_len)) return false;
+      reinterpret_cast<ExclusionRegistry const *>(copy.data())->snapshot(regions);
+      return true;
+    }
+
+  private:
+    static constexpr std::uint32_t FREE       = 0;
+    static constexpr std::uint32_t BUSY       = 1; ///< Being written, skipped by readers
+    static constexpr std::uint32_t ACTIVE     = 2;
+    static constexpr std::uint32_t STATE_MASK = 3; ///< Low bits of m_state; the rest is the generation
+
+    struct Slot {
+      std::atomic<std::uint32_t> m_state{FREE};
+      ExcludedRegion m_region;
+    };
+
+    static bool
+    _claim(Slot &slot, std::uint32_t state, std::uint32_t from) noexcept
+    {
+      return (state & STATE_MASK) == from
+             && slot.m_state.compare_exchange_strong(state, (state & ~STATE_MASK) | BUSY, std::memory_order_acquire);
+    }
+    static void
+    _release(Slot &slot, std::uint32_t claimed, std::uint32_t to) noexcept
+    {
+      slot.m_state.store(((claimed & ~STATE_MASK) + STATE_MASK + 1) | to, std::memory_order_release);
+    }
+
+    Slot m_slots[Constants::MAX_EXCLUDED_REGIONS];
+    std::atomic<size_t> m_used{0}; ///< Slots below this index may be ACTIVE
+    std::atomic<size_t> m_hint{0}; ///< Where the next add() starts probing
+  };
+
+  /**
+   * @brief One line of /proc/<pid>/maps
+   * @note m_pathname points into the text buffer of the owning MemoryMap
+   */
+  struct MemoryRegion {
+    std::uintptr_t m_start = 0;
+    std::uintptr_t m_end   = 0;
+    std::uint64_t m_offset = 0;
+    std::uint64_t m_inode  = 0;
+    char const *m_pathname = "";
+    std::uint8_t m_flags   = 0;
+    bool m_capture         = true; ///< Write contents (p_filesz == p_memsz) or the header only
+
+    size_t
+    size() const noexcept
+    {
+      return m_end - m_start;
+    }
+    bool
+    isFileBacked() const noexcept
+    {
+      return m_inode != 0 && m_pathname[0] == '/';
+    }
+  };
+
+  /**
+   * @class MemoryMap
+   * @brief Parsed snapshot of /proc/<pid>/maps
+   *
+   * The maps text is read with a single growing buffer and parsed in place, so
+   * enumerating thousands of mappings costs one read loop and no per-region
+   * allocations.
+   */
+  class MemoryMap
+  {
+  public:
+    MemoryMap()                             = default;
+    MemoryMap(MemoryMap const &)            = delete;
+    MemoryMap &operator=(MemoryMap const &) = delete;
+    MemoryMap(MemoryMap &&)                 = default;
+    MemoryMap &operator=(MemoryMap &&)      = default;
+
+    /**
+     * @brief Read and parse /proc/<pid>/maps
+     * @param pid Process whose mappings are enumerated
+     * @param filter Optional compiled memory filter; excluded mappings keep
+     * their program header but their contents are never read
+     * @return true on success, false if the maps file could not be read
+     */
+    bool load(pid_t pid, MemoryFilter const *filter = nullptr);
+
+    ArenaVector<MemoryRegion> &
+    getRegions() noexcept
+    {
+      return m_regions;
+    }
+    ArenaVector<MemoryRegion> const &
+    getRegions() const noexcept
+    {
+      return m_regions;
+    }
+
+    /**
+     * @brief Keep the headers but not the contents of [start, end)
+     * @details Used for scratch mappings of another process (e.g. its crash
+     * arena) and for ranges from ExclusionRegistry. Captured mappings that
+     * straddle a boundary are split there.
+     * @throws std::bad_alloc if a split mapping cannot be stored
+     */
+    void excludeRange(std::uintptr_t start, std::uintptr_t end);
+
+  private:
+    ArenaVector<char> m_text;
+    ArenaVector<MemoryRegion> m_regions;
+
+    void _parse(MemoryFilter const *filter);
+  };
+
+  /**
+   * @brief Leave the ranges of an exclusion registry snapshot out of a memory map
+   * @throws std::bad_alloc (see MemoryMap::excludeRange())
+   */
+  inline void
+  excludeRegions(MemoryMap &map, ArenaVector<ExcludedRegion> const &regions)
+  {
+    for(auto const &region : regions)
+      map.excludeRange(static_cast<std::uintptr_t>(region.m_start), static_cast<std::uintptr_t>(region.m_end));
+  }
+
+  /**
+   * @brief Serialize excluded ranges as an NT_CDGEN_EXCLUDED_REGIONS note descriptor
+   * @details Layout: u32 version, u32 count, then count ExcludedRegion entries
+   */
+  inline ArenaVector<char>
+  encodeExcludedRegions(ArenaVector<ExcludedRegion> const &regions)
+  {
+    std::uint32_t const header[2] = {Constants::EXCLUDED_REGIONS_VERSION, static_cast<std::uint32_t>(regions.size())};
+    ArenaVector<char> desc(sizeof(header) + regions.size() * sizeof(ExcludedRegion));
+    std::memcpy(desc.data(), header, sizeof(header));
+    if(!regions.empty())
+      std::memcpy(desc.data() + sizeof(header), regions.data(), regions.size() * sizeof(ExcludedRegion));
+    return desc;
+  }
+
+  /**
+   * @brief Register state of one thread as stored in NT_PRSTATUS / NT_FPREGSET
+   */
+  struct ThreadState {
+    pid_t m_tid = 0;
+    elf_gregset_t m_registers{};
+    elf_fpregset_t m_fpRegisters{};
+    bool m_hasFpRegisters = false;
+    int m_signal          = 0;
+  };
+
+  using ThreadList  = ArenaVector<ThreadState>;    ///< Captured threads, the faulting/requesting one first
+  using AddressList = ArenaVector<std::uintptr_t>; ///< Stack pointers of threads without registers
+
+  /**
+   * @brief Statistics reported by ElfCoreWriter::write()
+   */
+  struct CoreDumpStatistics {
+    size_t m_segmentCount           = 0; ///< PT_LOAD segments emitted
+    size_t m_capturedSegments       = 0; ///< PT_LOAD segments with contents
+    size_t m_threadCount            = 0; ///< NT_PRSTATUS notes emitted
+    std::uint64_t m_fileSize        = 0; ///< Logical size of the core file
+    std::uint64_t m_bytesWritten    = 0; ///< Bytes written to disk (differs from m_fileSize when compressed)
+    std::uint64_t m_holeBytes       = 0; ///< Zero bytes left as file holes (sparse output)
+    std::uint64_t m_memoryBytes     = 0; ///< Process memory copied into the core
+    std::uint64_t m_unreadableBytes = 0; ///< Bytes zero-filled after read faults
+    std::uint64_t m_nonResidentBytes = 0; ///< Swapped-out or untouched pages written as zeros without reading
+    std::uint64_t m_droppedBytes    = 0; ///< Memory left out to honor the size budget
+  };
+
+  /**
+   * @brief Process identifiers recorded in NT_PRSTATUS / NT_PRPSINFO
+   * @details Captured separately from the writer so that a forked snapshot
+   * child can describe the process it was forked from
+   */
+  struct ProcessIdentity {
+    pid_t m_pid  = 0;
+    pid_t m_ppid = 0;
+    pid_t m_pgrp = 0;
+    pid_t m_sid  = 0;
+
+    static ProcessIdentity
+    current() noexcept
+    {
+      ProcessIdentity identity;
+      identity.m_pid  = getpid();
+      identity.m_ppid = getppid();
+      identity.m_pgrp = getpgrp();
+      identity.m_sid  = getsid(0);
+      return identity;
+    }
+  };
+
+  /**
+   * @brief Convert a ucontext_t into core-file register sets
+   * @param state Output thread state
+   * @param tid Kernel thread id the context belongs to
+   * @param context Register context from getcontext() or a signal handler
+   * @note Must be called on the thread that owns the context so that the
+   * thread pointer (fs_base) can be recovered
+   */
+  inline void
+  fillThreadState(ThreadState &state, pid_t tid, ucontext_t const &context) noexcept
+  {
+    state.m_tid = tid;
+    std::memset(&state.m_registers, 0, sizeof(state.m_registers));
+    std::memset(&state.m_fpRegisters, 0, sizeof(state.m_fpRegisters));
+    state.m_hasFpRegisters = false;
+
+#if defined(__x86_64__)
+    static_assert(sizeof(user_regs_struct) == sizeof(elf_gregset_t), "unexpected elf_gregset_t layout");
+    auto *regs          = reinterpret_cast<user_regs_struct *>(&state.m_registers);
+    greg_t const *gregs = context.uc_mcontext.gregs;
+    auto const segmentOf = [](greg_t value, unsigned shift)
+    { return (static_cast<unsigned long long>(value) >> shift) & 0xFFFFULL; };
+
+    regs->r15                 = static_cast<unsigned long long>(gregs[REG_R15]);
+    regs->r14                 = static_cast<unsigned long long>(gregs[REG_R14]);
+    regs->r13                 = static_cast<unsigned long long>(gregs[REG_R13]);
+    regs->r12                 = static_cast<unsigned long long>(gregs[REG_R12]);
+    regs->rbp                 = static_cast<unsigned long long>(gregs[REG_RBP]);
+    regs->rbx                 = static_cast<unsigned long long>(gregs[REG_RBX]);
+    regs->r11                 = static_cast<unsigned long long>(gregs[REG_R11]);
+    regs->r10                 = static_cast<unsigned long long>(gregs[REG_R10]);
+    regs->r9                  = static_cast<unsigned long long>(gregs[REG_R9]);
+    regs->r8                  = static_cast<unsigned long long>(gregs[REG_R8]);
+    regs->rax                 = static_cast<unsigned long long>(gregs[REG_RAX]);
+    regs->rcx                 = static_cast<unsigned long long>(gregs[REG_RCX]);
+    regs->rdx                 = static_cast<unsigned long long>(gregs[REG_RDX]);
+    regs->rsi                 = static_cast<unsigned long long>(gregs[REG_RSI]);
+    regs->rdi                 = static_cast<unsigned long long>(gregs[REG_RDI]);
+    regs->orig_rax            = ~0ULL; // Not inside a restartable syscall
+    regs->rip                 = static_cast<unsigned long long>(gregs[REG_RIP]);
+    regs->eflags              = static_cast<unsigned long long>(gregs[REG_EFL]);
+    regs->rsp                 = static_cast<unsigned long long>(gregs[REG_RSP]);
+
+    // getcontext() does not store segment selectors; fall back to the
+    // standard 64-bit user selectors so debuggers accept the register set
+    unsigned long long const cs = segmentOf(gregs[REG_CSGSFS], 0);
+    regs->cs                    = cs != 0 ? cs : 0x33ULL;
+    regs->gs                    = segmentOf(gregs[REG_CSGSFS], 16);
+    regs->fs                    = segmentOf(gregs[REG_CSGSFS], 32);
+    regs->ss                    = 0x2BULL;
+
+    unsigned long fsBase = 0;
+    if(syscall(SYS_arch_prctl, 0x1003 /* ARCH_GET_FS */, &fsBase) == 0) regs->fs_base = fsBase;
+
+    if(context.uc_mcontext.fpregs != nullptr)
+    {
+      static_assert(sizeof(elf_fpregset_t) == sizeof(*context.uc_mcontext.fpregs), "unexpected elf_fpregset_t layout");
+      std::memcpy(&state.m_fpRegisters, context.uc_mcontext.fpregs, sizeof(state.m_fpRegisters));
+      state.m_hasFpRegisters = true;
+    }
+#elif defined(__aarch64__)
+    static_assert(sizeof(user_regs_struct) == sizeof(elf_gregset_t), "unexpected elf_gregset_t layout");
+    auto *regs = reinterpret_cast<user_regs_struct *>(&state.m_registers);
+    for(size_t i = 0; i < 31; ++i) regs->regs[i] = context.uc_mcontext.regs[i];
+    regs->sp     = context.uc_mcontext.sp;
+    regs->pc     = context.uc_mcontext.pc;
+    regs->pstate = context.uc_mcontext.pstate;
+#else
+    (void)context; // Registers are left zeroed on unsupported architectures
+#endif
+  }
+
+  /**
+   * @brief Stack pointer stored in a thread state (0 if unknown)
+   */
+  inline std::uintptr_t
+  stackPointerOf(ThreadState const &state) noexcept
+  {
+#if defined(__x86_64__) || defined(__aarch64__)
+    auto const *regs = reinterpret_cast<user_regs_struct const *>(&state.m_registers);
+  #if defined(__x86_64__)
+    return static_cast<std::uintptr_t>(regs->rsp);
+  #else
+    return static_cast<std::uintptr_t>(regs->sp);
+  #endif
+#else
+    (void)state;
+    return 0;
+#endif
+  }
+
+  /**
+   * @brief Instruction pointer stored in a thread state (0 if unknown)
+   */
+  inline std::uintptr_t
+  instructionPointerOf(ThreadState const &state) noexcept
+  {
+#if defined(__x86_64__) || defined(__aarch64__)
+    auto const *regs = reinterpret_cast<user_regs_struct const *>(&state.m_registers);
+  #if defined(__x86_64__)
+    return static_cast<std::uintptr_t>(regs->rip);
+  #else
+    return static_cast<std::uintptr_t>(regs->pc);
+  #endif
+#else
+    (void)state;
+    return 0;
+#endif
+  }
+
+  namespace CrashFlags
+  {
+    static constexpr std::uint32_t STACK_OVERFLOW = 1U << 0; ///< Faulted just below the thread stack
+    static constexpr std::uint32_t CORE_WRITTEN   = 1U << 1; ///< The core next to the record is complete
+  } // namespace CrashFlags
+
+  /**
+   * @brief Fixed-size summary of a crash for triage without the core
+   * @details Stored as the NT_CDGEN_CRASH_RECORD note of crash cores and,
+   * byte for byte, as the <core stem>.crashinfo sidecar. The faulting module
+   * and its file offset (m_module + m_moduleOffset) form a stable bucketing
+   * key across ASLR layouts.
+   */
+  struct CrashRecord {
+    char m_magic[8]                    = {'C', 'D', 'G', 'C', 'R', 'A', 'S', 'H'};
+    std::uint32_t m_version            = Constants::CRASH_RECORD_VERSION;
+    std::uint32_t m_size               = sizeof(CrashRecord); ///< Lets readers skip fields added later
+    std::int32_t m_signal              = 0;
+    std::int32_t m_code                = 0; ///< si_code (SEGV_MAPERR, SI_USER, ...)
+    std::int32_t m_errno               = 0; ///< si_errno
+    std::int32_t m_senderPid           = 0; ///< si_pid of a user-sent signal, 0 for faults
+    std::uint32_t m_senderUid          = 0; ///< si_uid of a user-sent signal
+    std::int32_t m_pid                 = 0;
+    std::int32_t m_tid                 = 0;
+    std::uint32_t m_flags              = 0; ///< CrashFlags
+    std::uint64_t m_faultAddress       = 0; ///< si_addr of SIGSEGV/SIGBUS/SIGILL/SIGFPE
+    std::uint64_t m_timestampNs        = 0; ///< CLOCK_REALTIME
+    std::uint64_t m_instructionPointer = 0;
+    std::uint64_t m_stackPointer       = 0;
+    std::uint64_t m_moduleOffset       = 0; ///< File offset of the instruction pointer within m_module
+    elf_gregset_t m_registers{};            ///< Same layout as NT_PRSTATUS pr_reg
+    char m_module[256] = {};                ///< Mapping holding the instruction pointer (truncated)
+  };
+
+  /**
+   * @brief Record the signal and register state of a crash
+   * @param pid Crashed process
+   * @param info Signal information, nullptr if unavailable (e.g. std::terminate())
+   * @note Async-signal-safe
+   */
+  inline void
+  fillCrashRecord(CrashRecord &record, pid_t pid, int signum, siginfo_t const *info, ThreadState const &thread) noexcept
+  {
+    record          = CrashRecord{};
+    record.m_signal = signum;
+    record.m_pid    = static_cast<std::int32_t>(pid);
+    record.m_tid    = static_cast<std::int32_t>(thread.m_tid);
+
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    record.m_timestampNs
+      = static_cast<std::uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<std::uint64_t>(now.tv_nsec);
+
+    if(info != nullptr)
+    {
+      record.m_code  = info->si_code;
+      record.m_errno = info->si_errno;
+      if(info->si_code <= 0) // SI_USER, SI_TKILL, SI_QUEUE: sent by a process
+      {
+        record.m_senderPid = static_cast<std::int32_t>(info->si_pid);
+        record.m_senderUid = static_cast<std::uint32_t>(info->si_uid);
+      }
+      else if(signum == SIGSEGV || signum == SIGBUS || signum == SIGILL || signum == SIGFPE)
+        record.m_faultAddress = reinterpret_cast<std::uintptr_t>(info->si_addr);
+    }
+
+    std::memcpy(&record.m_registers, &thread.m_registers, sizeof(record.m_registers));
+    record.m_instructionPointer = instructionPointerOf(thread);
+    record.m_stackPointer       = stackPointerOf(thread);
+  }
+
+  /**
+   * @brief Resolve the module and file offset of the recorded instruction pointer
+   */
+  inline void
+  resolveCrashModule(CrashRecord &record, MemoryMap const &map) noexcept
+  {
+    for(auto const &region : map.getRegions())
+    {
+      if(record.m_instructionPointer < region.m_start || record.m_instructionPointer >= region.m_end) continue;
+      record.m_moduleOffset = region.m_offset + (record.m_instructionPointer - region.m_start);
+      size_t const length   = std::min(std::strlen(region.m_pathname), sizeof(record.m_module) - 1);
+      std::memcpy(record.m_module, region.m_pathname, length);
+      record.m_module[length] = '\0';
+      return;
+    }
+  }
+
+  /**
+   * @brief Append text to a fixed buffer, truncating so the terminator always fits
+   * @param length Current length, advanced past the appended text
+   * @note Async-signal-safe, unlike snprintf, and leaves the buffer unterminated
+   */
+  inline void
+  appendText(char *buffer, size_t capacity, size_t &length, char const *text) noexcept
+  {
+    while(*text != '\0' && length + 1 < capacity) buffer[length++] = *text++;
+  }
+
+  /**
+   * @brief Append the decimal form of a number to a fixed buffer
+   * @see appendText()
+   */
+  inline void
+  appendDecimal(char *buffer, size_t capacity, size_t &length, unsigned long long value) noexcept
+  {
+    char digits[24];
+    char *cursor = digits + sizeof(digits);
+    *--cursor    = '\0';
+    do
+    {
+      *--cursor = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while(value != 0);
+    appendText(buffer, capacity, length, cursor);
+  }
+
+  /**
+   * @brief Format "/proc/<pid>/<name>" without snprintf, for use on the crash path
+   */
+  inline void
+  formatProcPath(char *buffer, size_t capacity, pid_t pid, char const *name) noexcept
+  {
+    size_t length = 0;
+    appendText(buffer, capacity, length, "/proc/");
+    appendDecimal(buffer, capacity, length, static_cast<unsigned long long>(pid));
+    appendText(buffer, capacity, length, "/");
+    appendText(buffer, capacity, length, name);
+    buffer[length] = '\0';
+  }
+
+  /**
+   * @brief Read a small /proc/<pid>/<name> file completely
+   * @return true if the file was read (possibly empty)
+   */
+  inline bool
+  readProcFile(pid_t pid, char const *name, ArenaVector<char> &content)
+  {
+    char path[64];
+    formatProcPath(path, sizeof(path), pid, name);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) return false;
+
+    content.resize(Constants::INITIAL_PROC_BUFFER);
+    size_t used = 0;
+    for(;;)
+    {
+      if(used == content.size()) content.resize(content.size() * 2);
+      ssize_t bytesRead = read(fd, content.data() + used, content.size() - used);
+      if(bytesRead < 0 && errno == EINTR) continue;
+      if(bytesRead < 0)
+      {
+        close(fd);
+        return false;
+      }
+      if(bytesRead == 0) break;
+      used += static_cast<size_t>(bytesRead);
+    }
+    close(fd);
+
+    content.resize(used);
+    return true;
+  }
+
+  /**
+   * @brief Bytes a process has passed to write() so far, from /proc/<pid>/io
+   * @param content Scratch buffer reused across calls
+   * @return false if the counter is unavailable
+   */
+  inline bool
+  readWriteCount(pid_t pid, ArenaVector<char> &content, std::uint64_t &count)
+  {
+    static char const key[] = "wchar: ";
+    if(!readProcFile(pid, "io", content)) return false;
+    auto digit = std::search(content.begin(), content.end(), key, key + sizeof(key) - 1);
+    if(digit == content.end()) return false;
+
+    count = 0;
+    for(digit += sizeof(key) - 1; digit != content.end() && *digit >= '0' && *digit <= '9'; ++digit)
+      count = count * 10 + static_cast<std::uint64_t>(*digit - '0');
+    return true;
+  }
+
+  /**
+   * @brief Kernel thread ids listed in /proc/<pid>/task
+   * @param pid Process to inspect
+   * @param excludeTid Thread left out of the list (typically the caller)
+   * @param tids Receives the thread ids
+   * @return false if the task directory could not be opened
+   */
+  inline bool
+  listThreadIds(pid_t pid, pid_t excludeTid, ArenaVector<pid_t> &tids)
+  {
+    // getdents64 into a stack buffer: opendir() would allocate its DIR stream with malloc
+    struct LinuxDirent64 {
+      std::uint64_t d_ino;
+      std::int64_t d_off;
+      unsigned short d_reclen;
+      unsigned char d_type;
+      char d_name[1];
+    };
+
+    char path[64];
+    formatProcPath(path, sizeof(path), pid, "task");
+    int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(fd < 0) return false;
+
+    alignas(8) char buffer[4096];
+    for(;;)
+    {
+      long const bytesRead = syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+      if(bytesRead < 0 && errno == EINTR) continue;
+      if(bytesRead <= 0) break;
+      for(long offset = 0; offset < bytesRead;)
+      {
+        auto const *entry = reinterpret_cast<LinuxDirent64 const *>(buffer + offset);
+        offset += entry->d_reclen;
+        if(entry->d_name[0] < '0' || entry->d_name[0] > '9') continue;
+        pid_t tid = 0;
+        for(char const *digit = entry->d_name; *digit >= '0' && *digit <= '9'; ++digit)
+          tid = tid * 10 + (*digit - '0');
+        if(tid != excludeTid) tids.push_back(tid);
+      }
+    }
+    close(fd);
+    return true;
+  }
+
+  /**
+   * @brief Stack pointer of a blocked thread, read from /proc/<pid>/task/<tid>/syscall
+   * @param content Scratch buffer reused across calls
+   * @return 0 if the thread is running or the file is unavailable
+   */
+  inline std::uintptr_t
+  readThreadStackPointer(pid_t pid, pid_t tid, ArenaVector<char> &content)
+  {
+    // Format: "<nr> <args x6> <sp> <pc>" or "-1 <sp> <pc>"; "running" has no SP
+    char path[64];
+    size_t length = 0;
+    appendText(path, sizeof(path), length, "task/");
+    appendDecimal(path, sizeof(path), length, static_cast<unsigned long long>(tid));
+    appendText(path, sizeof(path), length, "/syscall");
+    path[length] = '\0';
+    if(!readProcFile(pid, path, content)) return 0;
+
+    // Split by hand: strtok_r and strtoull are not async-signal-safe
+    size_t fieldCount        = 0;
+    std::uintptr_t fields[2] = {0, 0}; // Last two fields, parsed as hexadecimal
+    bool inField             = false;
+    for(char const character : content)
+    {
+      if(character == ' ' || character == '\n')
+      {
+        inField = false;
+        continue;
+      }
+      if(!inField)
+      {
+        inField   = true;
+        fields[0] = fields[1];
+        fields[1] = 0;
+        ++fieldCount;
+      }
+      unsigned const digit = character >= '0' && character <= '9'   ? static_cast<unsigned>(character - '0')
+                             : character >= 'a' && character <= 'f' ? static_cast<unsigned>(character - 'a' + 10)
+                                                                    : 0;
+      fields[1] = fields[1] * 16 + digit;
+    }
+    return fieldCount < 3 ? 0 : fields[0];
+  }
+
+  /**
+   * @brief Stack pointers of all threads except one, read from /proc/<pid>/task/<tid>/syscall
+   * @param pid Process to inspect
+   * @param excludeTid Thread whose registers are already known
+   * @param stackPointers Receives one entry per blocked thread (running threads report no SP)
+   */
+  inline void
+  readThreadStackPointers(pid_t pid, pid_t excludeTid, AddressList &stackPointers)
+  {
+    ArenaVector<pid_t> tids;
+    if(!listThreadIds(pid, excludeTid, tids)) return;
+
+    ArenaVector<char> content;
+    for(pid_t tid : tids)
+    {
+      std::uintptr_t const stackPointer = readThreadStackPointer(pid, tid, content);
+      if(stackPointer != 0) stackPointers.push_back(stackPointer);
+    }
+  }
+
+  /**
+   * @brief Shared state between captureThreadStates() and the capture signal handler
+   * @details Lives in static storage so that a signal arriving after a
+   * timed-out capture never touches freed memory
+   */
+  struct ThreadCaptureState {
+    std::atomic<bool> m_active{false};
+    std::atomic<int> m_inHandler{0};     ///< Handlers currently running
+    std::atomic<size_t> m_pending{0};    ///< Threads that have not answered yet
+    ThreadState *m_slots = nullptr;      ///< One slot per signalled thread (m_tid preset)
+    std::atomic<bool> *m_answered = nullptr;
+    size_t m_slotCount = 0;
+    pid_t m_pid        = 0;
+    std::mutex m_mutex; ///< Serializes captures
+  };
+
+  inline ThreadCaptureState &
+  threadCaptureState() noexcept
+  {
+    static ThreadCaptureState state;
+    return state;
+  }
+
+  /**
+   * @brief Capture signal handler: stores the interrupted context of the receiving thread
+   * @note Async-signal-safe: no allocation, no locks, errno preserved
+   */
+  inline void
+  threadCaptureHandler(int, siginfo_t *info, void *context)
+  {
+    ThreadCaptureState &state = threadCaptureState();
+    int const savedErrno      = errno;
+
+    state.m_inHandler.fetch_add(1);
+    if(state.m_active.load() && info != nullptr && info->si_code == SI_TKILL && info->si_pid == state.m_pid)
+    {
+      pid_t const tid = currentThreadId();
+      for(size_t index = 0; index < state.m_slotCount; ++index)
+      {
+        if(state.m_slots[index].m_tid != tid || state.m_answered[index].load()) continue;
+        fillThreadState(state.m_slots[index], tid, *static_cast<ucontext_t const *>(context));
+        state.m_answered[index].store(true);
+        state.m_pending.fetch_sub(1);
+        break;
+      }
+    }
+    state.m_inHandler.fetch_sub(1);
+
+    errno = savedErrno;
+  }
+
+  /**
+   * @brief Capture the registers of every other thread of the calling process
+   *
+   * Each thread listed in /proc/self/task receives a realtime signal through
+   * tgkill(); its handler converts the interrupted context into a ThreadState.
+   * Threads keep running afterwards, so a busy thread may have moved on by
+   * the time its stack is copied; blocked threads (the common case) are
+   * captured consistently. Threads that block the signal or do not answer
+   * within Constants::THREAD_CAPTURE_TIMEOUT fall back to the stack pointer
+   * published in /proc/self/task/<tid>/syscall. So does every thread when the
+   * signal already has a handler of the application.
+   *
+   * @param threads Captured states are appended (the caller's own thread is
+   * expected to be the first entry already)
+   * @param stackPointers Receives the stack pointers of threads without registers
+   * @note The handler is only installed over SIG_DFL and stays installed so
+   * that a late signal never triggers the default action (process termination)
+   */
+  inline void
+  captureThreadStates(ThreadList &threads, AddressList &stackPointers)
+  {
+    pid_t const pid  = getpid();
+    pid_t const self = currentThreadId();
+    ArenaVector<pid_t> tids;
+    if(!listThreadIds(pid, self, tids) || tids.empty()) return;
+
+    ThreadCaptureState &state = threadCaptureState();
+    std::lock_guard<std::mutex> lock(state.m_mutex);
+
+    // Never take the signal over from the application; checked on every call since it may install one later
+    int const signalNumber = SIGRTMIN + Constants::THREAD_CAPTURE_SIGNAL_OFFSET;
+    struct sigaction current;
+    bool handled = sigaction(signalNumber, nullptr, &current) == 0;
+    if(handled && !((current.sa_flags & SA_SIGINFO) && current.sa_sigaction == threadCaptureHandler))
+    {
+      struct sigaction action;
+      std::memset(&action, 0, sizeof(action));
+      action.sa_sigaction = threadCaptureHandler;
+      action.sa_flags     = SA_SIGINFO | SA_RESTART;
+      sigemptyset(&action.sa_mask);
+      handled = current.sa_handler == SIG_DFL && sigaction(signalNumber, &action, nullptr) == 0;
+    }
+    if(!handled)
+    {
+      ArenaVector<char> content;
+      for(pid_t tid : tids)
+      {
+        std::uintptr_t const stackPointer = readThreadStackPointer(pid, tid, content);
+        if(stackPointer != 0) stackPointers.push_back(stackPointer);
+      }
+      return;
+    }
+
+    ThreadList slots(tids.size());
+    std::unique_ptr<std::atomic<bool>[]> answered(new std::atomic<bool>[tids.size()]);
+    for(size_t index = 0; index < tids.size(); ++index)
+    {
+      slots[index].m_tid = tids[index];
+      answered[index].store(false);
+    }
+
+    state.m_slots     = slots.data();
+    state.m_answered  = answered.get();
+    state.m_slotCount = slots.size();
+    state.m_pid       = pid;
+    state.m_pending.store(tids.size());
+    state.m_active.store(true);
+
+    for(size_t index = 0; index < tids.size(); ++index)
+      if(syscall(SYS_tgkill, pid, tids[index], signalNumber) != 0) state.m_pending.fetch_sub(1); // Thread exited
+
+    auto const deadline = std::chrono::steady_clock::now() + Constants::THREAD_CAPTURE_TIMEOUT;
+    while(state.m_pending.load() > 0 && std::chrono::steady_clock::now() < deadline) sched_yield();
+
+    // Close the window, then wait for handlers that already passed the check
+    state.m_active.store(false);
+    while(state.m_inHandler.load() > 0) sched_yield();
+    state.m_slots     = nullptr;
+    state.m_answered  = nullptr;
+    state.m_slotCount = 0;
+
+    ArenaVector<char> content;
+    for(size_t index = 0; index < slots.size(); ++index)
+    {
+      if(answered[index].load())
+        threads.push_back(slots[index]);
+      else
+      {
+        std::uintptr_t const stackPointer = readThreadStackPointer(pid, tids[index], content);
+        if(stackPointer != 0) stackPointers.push_back(stackPointer);
+      }
+    }
+  }
+
+  /**
+   * @brief Stop the threads of another process and read their registers with ptrace
+   *
+   * Every thread except excludeTid is attached with PTRACE_SEIZE and stopped
+   * with PTRACE_INTERRUPT, so its registers are exact and its stack stays
+   * unchanged while the core is written. Threads that cannot be attached
+   * (Yama scope, an existing tracer, a thread that just exited) contribute
+   * the stack pointer published in /proc/<pid>/task/<tid>/syscall instead.
+   *
+   * @param pid Process to inspect; the caller needs ptrace access to it
+   * @param excludeTid Thread whose registers are already known
+   * @param threads Captured states are appended
+   * @param stackPointers Receives the stack pointers of threads without registers
+   * @param seized Receives the attached threads, to be passed to releaseThreads()
+   */
+  inline void
+  seizeThreads(pid_t pid, pid_t excludeTid, ThreadList &threads, AddressList &stackPointers, ArenaVector<pid_t> &seized)
+  {
+    ArenaVector<pid_t> tids;
+    if(!listThreadIds(pid, excludeTid, tids)) return;
+
+    ArenaVector<char> content;
+    for(pid_t tid : tids)
+    {
+      if(ptrace(PTRACE_SEIZE, tid, nullptr, nullptr) == 0)
+      {
+        seized.push_back(tid);
+        int status = 0;
+        if(ptrace(PTRACE_INTERRUPT, tid, nullptr, nullptr) == 0 && waitpid(tid, &status, __WALL) == tid
+           && WIFSTOPPED(status))
+        {
+          ThreadState state;
+          state.m_tid         = tid;
+          struct iovec vector = {&state.m_registers, sizeof(state.m_registers)};
+          if(ptrace(PTRACE_GETREGSET, tid, reinterpret_cast<void *>(NT_PRSTATUS), &vector) == 0)
+          {
+            vector.iov_base        = &state.m_fpRegisters;
+            vector.iov_len         = sizeof(state.m_fpRegisters);
+            state.m_hasFpRegisters = ptrace(PTRACE_GETREGSET, tid, reinterpret_cast<void *>(NT_PRFPREG), &vector) == 0;
+            threads.push_back(state);
+            continue;
+          }
+        }
+      }
+      std::uintptr_t const stackPointer = readThreadStackPointer(pid, tid, content);
+      if(stackPointer != 0) stackPointers.push_back(stackPointer);
+    }
+  }
+
+  /**
+   * @brief Detach from threads stopped by seizeThreads() and let them run
+   */
+  inline void
+  releaseThreads(ArenaVector<pid_t> const &seized) noexcept
+  {
+    for(pid_t tid : seized) ptrace(PTRACE_DETACH, tid, nullptr, nullptr);
+  }
+
+  /**
+   * @brief Process a crash dump is written for, and how
+   * @details Also the first message from a process to its crash helper: the
+   * packet continues with NUL-terminated strings holding the crash path
+   * prefix, the filename token and then one string per memory filter.
+   */
+  struct CrashTarget {
+    std::uint32_t m_version = Constants::CRASH_HELPER_VERSION;
+    ProcessIdentity m_identity;
+    std::uint64_t m_arenaStart      = 0; ///< Crash arena of the process, never dumped
+    std::uint64_t m_arenaEnd        = 0;
+    std::uint64_t m_registryAddress = 0; ///< ExclusionRegistry::instance() of the process
+    std::uint64_t m_maxSizeBytes    = 0; ///< Size budget (0 = unlimited)
+    DumpType m_type                 = DumpType::DEFAULT_AUTO;
+    CompressionCodec m_codec        = CompressionCodec::ZSTD;
+    std::int32_t m_level            = 0;
+    bool m_compress                 = false; ///< Codecs allocate, so only the helper compresses
+    bool m_sparse                   = false;
+    bool m_skipNonResident          = false;
+  };
+
+  /**
+   * @brief Crash notification, sent from the signal handler
+   */
+  struct HelperRequest {
+    std::uint32_t m_version = Constants::CRASH_HELPER_VERSION;
+    std::int32_t m_pid      = 0; ///< Sender; a forked child sharing the socket is refused
+    std::int32_t m_signal   = 0;
+    std::uint32_t m_hasInfo = 0;
+    siginfo_t m_info;
+    ThreadState m_thread; ///< Registers of the crashing thread
+  };
+
+  /**
+   * @brief Helper answer once the dump is on disk (or has failed)
+   */
+  struct HelperReply {
+    std::uint32_t m_written = 0;
+    char m_path[PATH_MAX]   = {}; ///< Core file written
+  };
+
+  /**
+   * @brief Portable zero check, 64 bytes per iteration
+   */
+  inline bool
+  isZeroMemoryScalar(void const *data, size_t size) noexcept
+  {
+    auto const *bytes = static_cast<unsigned char const *>(data);
+    size_t offset     = 0;
+    for(; offset + 64 <= size; offset += 64)
+    {
+      std::uint64_t words[8];
+      std::memcpy(words, bytes + offset, sizeof(words));
+      if((words[0] | words[1] | words[2] | words[3] | words[4] | words[5] | words[6] | words[7]) != 0) return false;
+    }
+    for(; offset < size; ++offset)
+      if(bytes[offset] != 0) return false;
+    return true;
+  }
+
+#if CORE_DUMP_GENERATOR_X86_SIMD && defined(__SSE2__)
+  /**
+   * @brief SSE2 zero check (baseline on x86_64)
+   */
+  inline bool
+  isZeroMemorySse2(void const *data, size_t size) noexcept
+  {
+    auto const *bytes = static_cast<char const *>(data);
+    size_t offset     = 0;
+    __m128i const zero = _mm_setzero_si128();
+    for(; offset + 64 <= size; offset += 64)
+    {
+      __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes + offset));
+      __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes + offset + 16));
+      __m128i const c = _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes + offset + 32));
+      __m128i const d = _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes + offset + 48));
+      __m128i const any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+      if(_mm_movemask_epi8(_mm_cmpeq_epi8(any, zero)) != 0xFFFF) return false;
+    }
+    return isZeroMemoryScalar(bytes + offset, size - offset);
+  }
+#endif
+
+#if CORE_DUMP_GENERATOR_X86_SIMD
+  /**
+   * @brief AVX2 zero check, compiled for AVX2 regardless of the build target
+   * @note Only called after a runtime CPU feature check
+   */
+  __attribute__((target("avx2"))) inline bool
+  isZeroMemoryAvx2(void const *data, size_t size) noexcept
+  {
+    auto const *bytes = static_cast<char const *>(data);
+    size_t offset     = 0;
+    for(; offset + 64 <= size; offset += 64)
+    {
+      __m256i const a   = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(bytes + offset));
+      __m256i const b   = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(bytes + offset + 32));
+      __m256i const any = _mm256_or_si256(a, b);
+      if(!_mm256_testz_si256(any, any)) return false;
+    }
+    return isZeroMemoryScalar(bytes + offset, size - offset);
+  }
+#endif
+
+  using ZeroScanFunction = bool (*)(void const *, size_t) noexcept;
+
+  /**
+   * @brief Pick the widest zero-scan kernel the CPU supports
+   */
+  inline ZeroScanFunction
+  selectZeroScanFunction() noexcept
+  {
+#if CORE_DUMP_GENERATOR_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) return &isZeroMemoryAvx2;
+#endif
+#if CORE_DUMP_GENERATOR_X86_SIMD && defined(__SSE2__)
+    return &isZeroMemorySse2;
+#else
+    return &isZeroMemoryScalar;
+#endif
+  }
+
+  /**
+   * @brief Whether a buffer contains only zero bytes (runtime-dispatched SIMD)
+   */
+  inline bool
+  isZeroMemory(void const *data, size_t size) noexcept
+  {
+    static ZeroScanFunction const scan = selectZeroScanFunction();
+    return scan(data, size);
+  }
+
+  /**
+   * @class OutputSink
+   * @brief Destination of the sequential core byte stream
+   */
+  class OutputSink
+  {
+  public:
+    OutputSink()                              = default;
+    virtual ~OutputSink() noexcept            = default;
+    OutputSink(OutputSink const &)            = delete;
+    OutputSink &operator=(OutputSink const &) = delete;
+
+    /**
+     * @brief Append bytes to the stream
+     * @return false on I/O or codec failure
+     */
+    virtual bool write(void const *data, size_t size) noexcept = 0;
+
+    /**
+     * @brief Append zero bytes
+     * @details The default writes literal zeros; sinks that support holes
+     * seek past them instead
+     */
+    virtual bool
+    skip(size_t size) noexcept
+    {
+      static char const zeros[4096] = {};
+      while(size > 0)
+      {
+        size_t const chunk = std::min(size, sizeof(zeros));
+        if(!write(zeros, chunk)) return false;
+        size -= chunk;
+      }
+      return true;
+    }
+
+    /**
+     * @brief Whether skip() leaves holes, making zero detection worthwhile
+     */
+    virtual bool
+    supportsHoles() const noexcept
+    {
+      return false;
+    }
+
+    /**
+     * @brief Flush buffered data; no writes are allowed afterwards
+     */
+    virtual bool
+    finish() noexcept
+    {
+      return true;
+    }
+
+    /**
+     * @brief Bytes that reached the file descriptor so far
+     */
+    std::uint64_t
+    getBytesWritten() const noexcept
+    {
+      return m_bytesWritten;
+    }
+
+    /**
+     * @brief Bytes left as holes instead of being written
+     */
+    std::uint64_t
+    getHoleBytes() const noexcept
+    {
+      return m_holeBytes;
+    }
+
+  protected:
+    std::uint64_t m_bytesWritten = 0;
+    std::uint64_t m_holeBytes    = 0;
+
+    bool
+    _writeToFd(int fd, void const *data, size_t size) noexcept
+    {
+      auto const *cursor = static_cast<char const *>(data);
+      while(size > 0)
+      {
+        ssize_t written = ::write(fd, cursor, size);
+        if(written < 0 && errno == EINTR) continue;
+        if(written <= 0) return false;
+        cursor += written;
+        size -= static_cast<size_t>(written);
+        m_bytesWritten += static_cast<std::uint64_t>(written);
+      }
+      return true;
+    }
+  };
+
+  /**
+   * @class FileOutputSink
+   * @brief Writes the core stream unmodified, optionally as a sparse file
+   *
+   * In sparse mode skipped ranges are seeked over so the file system
+   * allocates no blocks for them; a trailing hole is materialized with
+   * ftruncate() in finish(). Non-seekable descriptors (pipes) fall back to
+   * writing zeros.
+   */
+  class FileOutputSink : public OutputSink
+  {
+  public:
+    explicit FileOutputSink(int fd, bool sparse = false) noexcept : m_fd(fd), m_sparse(sparse) {}
+
+    bool
+    write(void const *data, size_t size) noexcept override
+    {
+      m_trailingHole = false;
+      return _writeToFd(m_fd, data, size);
+    }
+
+    bool
+    skip(size_t size) noexcept override
+    {
+      if(m_sparse && size > 0)
+      {
+        if(lseek(m_fd, static_cast<off_t>(size), SEEK_CUR) >= 0)
+        {
+          m_holeBytes += size;
+          m_trailingHole = true;
+          return true;
+        }
+        m_sparse = false; // ESPIPE and friends: write zeros from now on
+      }
+      return OutputSink::skip(size);
+    }
+
+    bool
+    supportsHoles() const noexcept override
+    {
+      return m_sparse;
+    }
+
+    bool
+    finish() noexcept override
+    {
+      if(!m_trailingHole) return true;
+      off_t const end = lseek(m_fd, 0, SEEK_CUR);
+      return end >= 0 && ftruncate(m_fd, end) == 0;
+    }
+
+  private:
+    int m_fd;
+    bool m_sparse;
+    bool m_trailingHole = false;
+  };
+
+  /**
+   * @brief Whether a codec was compiled in
+   */
+  inline bool
+  isCompressionAvailable(CompressionCodec codec) noexcept
+  {
+    switch(codec)
+    {
+      case CompressionCodec::ZSTD: return CORE_DUMP_GENERATOR_HAS_ZSTD != 0;
+      case CompressionCodec::LZ4: return CORE_DUMP_GENERATOR_HAS_LZ4 != 0;
+    }
+    return false;
+  }
+
+  /**
+   * @brief File name suffix for a codec (".zst" / ".lz4")
+   */
+  inline char const *
+  compressionExtension(CompressionCodec codec) noexcept
+  {
+    return codec == CompressionCodec::LZ4 ? ".lz4" : ".zst";
+  }
+
+  /**
+   * @class FrameCompressor
+   * @brief Codec state for compressing independent frames on one thread
+   */
+  class FrameCompressor
+  {
+  public:
+    FrameCompressor(CompressionCodec codec, int level, size_t frameSize) noexcept;
+    ~FrameCompressor() noexcept;
+    FrameCompressor(FrameCompressor const &)            = delete;
+    FrameCompressor &operator=(FrameCompressor const &) = delete;
+
+    /**
+     * @brief Worst-case compressed size of one frame (0 if the codec is unusable)
+     */
+    size_t
+    getBound() const noexcept
+    {
+      return m_bound;
+    }
+
+    /**
+     * @brief Compress one frame
+     * @return Compressed size, 0 on failure
+     */
+    size_t compress(char const *input, size_t inputSize, char *output, size_t outputCapacity) noexcept;
+
+  private:
+    CompressionCodec m_codec;
+    int m_level;
+    size_t m_bound = 0;
+#if CORE_DUMP_GENERATOR_HAS_ZSTD
+    ZSTD_CCtx *m_zstdContext = nullptr;
+#endif
+#if CORE_DUMP_GENERATOR_HAS_LZ4
+    LZ4F_cctx *m_lz4Context = nullptr;
+    LZ4F_preferences_t m_lz4Preferences{};
+#endif
+  };
+
+  /**
+   * @class CompressedOutputSink
+   * @brief Compresses the core stream in independent fixed-size frames
+   *
+   * The caller thread acts as the reader and fills frame buffers. With no
+   * workers every full frame is compressed inline. With workers, full frames
+   * are queued to N compression threads and a dedicated writer thread emits
+   * them strictly in sequence. A bounded pool of 2*N frames caps peak memory
+   * and applies back-pressure to the reader.
+   *
+   * A seek table in the zstd seekable format (skippable frame, magic
+   * 0x184D2A5E) is appended, so readers can jump to any frame. Both zstd and
+   * LZ4 decoders skip it.
+   */
+  class CompressedOutputSink : public OutputSink
+  {
+  public:
+    CompressedOutputSink(int fd, CompressionCodec codec, int level, size_t workerCount = 0,
+                         size_t frameSize = Constants::COMPRESSION_FRAME) noexcept;
+    ~CompressedOutputSink() noexcept override;
+
+    /**
+     * @brief Whether codec state and buffers were set up successfully
+     */
+    bool
+    isReady() const noexcept
+    {
+      return m_ready;
+    }
+
+    /**
+     * @brief Number of compression threads (0 = inline compression)
+     */
+    size_t
+    getWorkerCount() const noexcept
+    {
+      return m_workerCount;
+    }
+
+    bool write(void const *data, size_t size) noexcept override;
+    bool finish() noexcept override;
+
+  private:
+    struct Frame {
+      std::vector<char> m_input;
+      std::vector<char> m_output;
+      size_t m_inputSize  = 0;
+      size_t m_outputSize = 0;
+      size_t m_sequence   = 0;
+    };
+
+    int m_fd;
+    CompressionCodec m_codec;
+    int m_level;
+    size_t m_frameSize;
+    size_t m_workerCount = 0;
+    bool m_ready         = false;
+    bool m_finished      = false;
+    std::vector<std::unique_ptr<Frame>> m_frames;
+    Frame *m_current      = nullptr;
+    size_t m_nextSequence = 0;
+    std::unique_ptr<FrameCompressor> m_inlineCompressor;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> m_seekTable; ///< {compressed, decompressed} per frame
+
+    // Pipeline state (guarded by m_mutex)
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_frameReady;
+    std::condition_variable m_frameFree;
+    std::vector<Frame *> m_freeFrames;
+    std::deque<Frame *> m_pendingFrames;
+    std::map<size_t, Frame *> m_compressedFrames;
+    size_t m_nextToWrite = 0;
+    bool m_stopping      = false;
+    std::atomic<bool> m_failed{false};
+    std::vector<std::thread> m_workers;
+    std::thread m_writer;
+
+    Frame *_acquireFrame() noexcept;
+    bool _submitFrame() noexcept;
+    bool _emitFrame(Frame const &frame) noexcept;
+    bool _writeSeekTable() noexcept;
+    void _workerLoop() noexcept;
+    void _writerLoop() noexcept;
+    void _stopThreads() noexcept;
+  };
+
+  /**
+   * @brief Create the sink selected by the compression settings
+   * @param workerCount Compression threads for the parallel pipeline (0 = inline)
+   * @param sparse Leave zero pages as holes (uncompressed output only)
+   * @return Compressed sink if requested and available, plain file sink
+   * otherwise; nullptr if the codec could not be initialized
+   */
+  inline std::unique_ptr<OutputSink>
+  createOutputSink(int fd, bool compress, CompressionCodec codec, int level, size_t workerCount = 0,
+                   bool sparse = false)
+  {
+    if(!compress || !isCompressionAvailable(codec)) return std::unique_ptr<OutputSink>(new FileOutputSink(fd, sparse));
+
+    std::unique_ptr<CompressedOutputSink> sink(new CompressedOutputSink(fd, codec, level, workerCount));
+    if(!sink->isReady()) return nullptr;
+    return std::unique_ptr<OutputSink>(sink.release());
+  }
+
+  /**
+   * @brief Write a buffer, turning runs of all-zero pages into skip() calls
+   * @details Only worthwhile if sink.supportsHoles()
+   */
+  inline bool
+  writeSparse(OutputSink &sink, char const *data, size_t size, size_t pageSize) noexcept
+  {
+    // Coalesce runs of equal page kind so each run costs one write or seek
+    size_t offset = 0;
+    while(offset < size)
+    {
+      bool const zero = isZeroMemory(data + offset, std::min(pageSize, size - offset));
+      size_t runEnd   = offset + std::min(pageSize, size - offset);
+      while(runEnd < size && isZeroMemory(data + runEnd, std::min(pageSize, size - runEnd)) == zero)
+        runEnd += std::min(pageSize, size - runEnd);
+
+      bool const ok = zero ? sink.skip(runEnd - offset) : sink.write(data + offset, runEnd - offset);
+      if(!ok) return false;
+      offset = runEnd;
+    }
+    return true;
+  }
+
+  /**
+   * @brief PID of the crashed process, from the name of a systemd-coredump file
+   * @details The PID is the second to last dot-separated field, before an optional compression suffix:
+   *          core.<exe>.<uid>.<boot-id>.<pid>.<time>[.zst|.lz4|.xz]. The executable name may contain dots.
+   * @param fileName File name without directory
+   * @param pid Receives the decimal PID
+   * @return false if the name does not end in numeric <pid>.<time> fields
+   */
+  inline bool
+  parseSystemdCorePid(std::string const &fileName, std::string &pid)
+  {
+    std::vector<std::string> fields;
+    for(size_t begin = 0;;)
+    {
+      size_t const dot = fileName.find('.', begin);
+      fields.push_back(fileName.substr(begin, dot == std::string::npos ? std::string::npos : dot - begin));
+      if(dot == std::string::npos) break;
+      begin = dot + 1;
+    }
+    auto const isNumber = [](std::string const &field) {
+      return !field.empty() && field.find_first_not_of("0123456789") == std::string::npos;
+    };
+    if(!fields.empty() && !isNumber(fields.back())) fields.pop_back();
+    if(fields.size() < 2 || !isNumber(fields.back()) || !isNumber(fields[fields.size() - 2])) return false;
+    pid = fields[fields.size() - 2];
+    return true;
+  }
+
+  /**
+   * @brief Outcome of extractSystemdCore()
+   */
+  struct ExtractionStatistics {
+    std::string m_path;              ///< File that was written
+    std::uint64_t m_inputBytes  = 0; ///< Bytes of the systemd-coredump file
+    std::uint64_t m_outputBytes = 0; ///< Bytes of the written file, holes included
+    std::uint64_t m_holeBytes   = 0; ///< Zero pages left as holes (decompressed output only)
+    double m_seconds            = 0.0;
+    bool m_decompressed         = false;
+  };
+
+  /**
+   * @brief Copy or decompress one file written by systemd-coredump
+   * @details Cores compressed with a codec that is compiled in are stream-decompressed into a sparse file if
+   *          decompress is set. Anything else is copied unchanged with copy_file_range() (read()/write() where
+   *          the kernel or file system cannot) and keeps its compression suffix. The file is written as
+   *          "<path>.partial" and renamed once complete.
+   * @param source File in the systemd-coredump directory (core.<exe>.<uid>.<boot-id>.<pid>.<time>[.zst|.lz4|.xz])
+   * @param targetStem Output path without compression suffix
+   * @return false if the source could not be read or the output could not be written
+   */
+  inline bool
+  extractSystemdCore(std::string const &source, std::string const &targetStem, bool decompress,
+                     ExtractionStatistics &stats) noexcept
+  {
+    try
+    {
+      auto const started = std::chrono::steady_clock::now();
+      stats              = ExtractionStatistics();
+
+      // systemd-coredump names its codecs by suffix; the uncompressed name ends in the numeric timestamp
+      std::string suffix;
+      size_t const dot = source.rfind('.');
+      if(dot != std::string::npos && source.find('/', dot) == std::string::npos
+         && source.find_first_not_of("0123456789", dot + 1) != std::string::npos)
+        suffix = source.substr(dot);
+      bool canDecompress     = false;
+      CompressionCodec codec = CompressionCodec::ZSTD;
+      if(suffix == ".lz4") codec = CompressionCodec::LZ4;
+      if(suffix == ".zst" || suffix == ".lz4") canDecompress = decompress && isCompressionAvailable(codec);
+
+      int const input = open(source.c_str(), O_RDONLY | O_CLOEXEC);
+      if(input < 0) return false;
+      struct stat sourceStat;
+      if(fstat(input, &sourceStat) != 0)
+      {
+        close(input);
+        return false;
+      }
+
+      stats.m_path                      = targetStem + (canDecompress ? "" : suffix);
+      std::string const partialFilename = stats.m_path + ".partial";
+      int const output = open(partialFilename.c_str(), O_CREAT | O_TRUNC | O_WRONLY | O_NOFOLLOW | O_CLOEXEC, 0640);
+      if(output < 0)
+      {
+        close(input);
+        return false;
+      }
+
+      bool written = true;
+      if(canDecompress)
+      {
+        // Decompressed chunks are only handed on in whole buffers, so zero pages stay page-aligned
+        FileOutputSink sink(output, true);
+        size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        std::vector<char> compressed(Constants::COPY_CHUNK_SIZE);
+        std::vector<char> plain(Constants::COPY_CHUNK_SIZE);
+        size_t plainFilled = 0;
+        bool frameEnded    = false;
+        auto const flush   = [&]() {
+          written = written && writeSparse(sink, plain.data(), plainFilled, pageSize);
+          stats.m_outputBytes += plainFilled;
+          plainFilled = 0;
+        };
+  #if CORE_DUMP_GENERATOR_HAS_ZSTD
+        ZSTD_DCtx *zstdContext = nullptr;
+        if(codec == CompressionCodec::ZSTD) written = (zstdContext = ZSTD_createDCtx()) != nullptr;
+  #endif
+  #if CORE_DUMP_GENERATOR_HAS_LZ4
+        LZ4F_dctx *lz4Context = nullptr;
+        if(codec == CompressionCodec::LZ4)
+          written = !LZ4F_isError(LZ4F_createDecompressionContext(&lz4Context, LZ4F_VERSION));
+  #endif
+        // One decoder call: consumes up to sourceSize bytes and updates it to what was used
+        auto const step = [&](char const *data, size_t &sourceSize) {
+          size_t targetSize = plain.size() - plainFilled;
+          (void)data;
+          (void)sourceSize;
+  #if CORE_DUMP_GENERATOR_HAS_ZSTD
+          if(codec == CompressionCodec::ZSTD)
+          {
+            ZSTD_inBuffer in   = {data, sourceSize, 0};
+            ZSTD_outBuffer out = {plain.data() + plainFilled, targetSize, 0};
+            size_t const hint  = ZSTD_decompressStream(zstdContext, &out, &in);
+            written            = !ZSTD_isError(hint);
+            frameEnded         = hint == 0;
+            sourceSize         = in.pos;
+            targetSize         = out.pos;
+          }
+  #endif
+  #if CORE_DUMP_GENERATOR_HAS_LZ4
+          if(codec == CompressionCodec::LZ4)
+          {
+            size_t const hint
+              = LZ4F_decompress(lz4Context, plain.data() + plainFilled, &targetSize, data, &sourceSize, nullptr);
+            written    = !LZ4F_isError(hint);
+            frameEnded = hint == 0;
+          }
+  #endif
+          plainFilled += targetSize;
+          if(plainFilled == plain.size()) flush();
+          return targetSize;
+        };
+        while(written)
+        {
+          ssize_t const bytesRead = read(input, compressed.data(), compressed.size());
+          if(bytesRead < 0 && errno == EINTR) continue;
+          if(bytesRead == 0)
+          {
+            // Drain what the decoder still holds back after the last input
+            size_t none = 0;
+            while(written && !frameEnded && step(compressed.data(), none) > 0) {}
+            written = written && frameEnded;
+            break;
+          }
+          written = bytesRead > 0;
+          if(!written) break;
+          stats.m_inputBytes += static_cast<std::uint64_t>(bytesRead);
+          for(size_t consumed = 0; written && consumed < static_cast<size_t>(bytesRead);)
+          {
+            size_t sourceSize = static_cast<size_t>(bytesRead) - consumed;
+            step(compressed.data() + consumed, sourceSize);
+            consumed += sourceSize;
+          }
+        }
+        if(plainFilled > 0) flush();
+        written              = written && sink.finish();
+        stats.m_holeBytes    = sink.getHoleBytes();
+        stats.m_decompressed = true;
+  #if CORE_DUMP_GENERATOR_HAS_ZSTD
+        if(zstdContext != nullptr) ZSTD_freeDCtx(zstdContext);
+  #endif
+  #if CORE_DUMP_GENERATOR_HAS_LZ4
+        if(lz4Context != nullptr) LZ4F_freeDecompressionContext(lz4Context);
+  #endif
+      }
+      else
+      {
+        // In-kernel copy; reflinks the extents on file systems that support it
+        std::uint64_t const size = static_cast<std::uint64_t>(sourceStat.st_size);
+        std::uint64_t copied     = 0;
+  #ifdef SYS_copy_file_range
+        while(copied < size)
+        {
+          size_t const request = static_cast<size_t>(std::min<std::uint64_t>(size - copied, 1ULL << 30));
+          long const result    = syscall(SYS_copy_file_range, input, nullptr, output, nullptr, request, 0U);
+          if(result < 0 && errno == EINTR) continue;
+          if(result <= 0)
+          {
+            written = result == 0 || (copied == 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL
+                                                      || errno == EOPNOTSUPP));
+            break;
+          }
+          copied += static_cast<std::uint64_t>(result);
+        }
+  #endif
+        // Fallback for kernels and file systems without copy_file_range()
+        std::vector<char> buffer(Constants::COPY_CHUNK_SIZE);
+        FileOutputSink sink(output);
+        while(written)
+        {
+          ssize_t const bytesRead = read(input, buffer.data(), buffer.size());
+          if(bytesRead < 0 && errno == EINTR) continue;
+          if(bytesRead <= 0)
+          {
+            written = bytesRead == 0;
+            break;
+          }
+          written = sink.write(buffer.data(), static_cast<size_t>(bytesRead));
+          copied += static_cast<std::uint64_t>(bytesRead);
+        }
+        stats.m_inputBytes  = copied;
+        stats.m_outputBytes = copied;
+      }
+
+      close(input);
+      written = (close(output) == 0) && written && rename(partialFilename.c_str(), stats.m_path.c_str()) == 0;
+      if(!written) unlink(partialFilename.c_str());
+      stats.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+      return written;
+    }
+    catch(...)
+    {
+      return false;
+    }
+  }
+
+  /**
+   * @brief Page range written as zeros instead of being read
+   * @note Layout of the entries of the NT_CDGEN_NON_RESIDENT note
+   */
+  struct SkippedRange {
+    std::uint64_t m_start = 0;
+    std::uint64_t m_end   = 0;
+  };
+
+  /**
+   * @brief Result of planResidency()
+   */
+  struct ResidencyPlan {
+    ArenaVector<SkippedRange> m_ranges; ///< Sorted by address
+    std::uint64_t m_bytes = 0;
+  };
+
+  /**
+   * @brief Find captured pages that reading would fault in from swap or allocate
+   *
+   * Consults /proc/<pid>/pagemap: swapped-out pages and anonymous pages that
+   * were never touched (their contents are zero) are skipped. File-backed
+   * pages that are not mapped yet are still read; they come from the page
+   * cache or the file, never from swap.
+   *
+   * @return false if pagemap is unavailable (plan left empty)
+   */
+  inline bool
+  planResidency(pid_t pid, MemoryMap const &map, ResidencyPlan &plan)
+  {
+    char path[64];
+    formatProcPath(path, sizeof(path), pid, "pagemap");
+    int const fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) return false;
+
+    size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::uint64_t entries[Constants::PAGEMAP_BATCH_PAGES];
+    for(auto const &region : map.getRegions())
+    {
+      if(!region.m_capture) continue;
+      bool const anonymous = !region.isFileBacked();
+      std::uintptr_t page  = region.m_start;
+      while(page < region.m_end)
+      {
+        size_t const pages      = std::min(Constants::PAGEMAP_BATCH_PAGES, (region.m_end - page) / pageSize);
+        ssize_t const bytesRead = pread(fd, entries, pages * sizeof(entries[0]),
+                                        static_cast<off_t>(page / pageSize * sizeof(entries[0])));
+        if(bytesRead < static_cast<ssize_t>(sizeof(entries[0]))) break; // Treat the rest as resident
+
+        size_t const count = static_cast<size_t>(bytesRead) / sizeof(entries[0]);
+        for(size_t index = 0; index < count; ++index, page += pageSize)
+        {
+          bool const present = ((entries[index] >> 63) & 1U) != 0;
+          bool const swapped = ((entries[index] >> 62) & 1U) != 0;
+          if(!swapped && (present || !anonymous)) continue;
+
+          if(!plan.m_ranges.empty() && plan.m_ranges.back().m_end == page)
+            plan.m_ranges.back().m_end += pageSize;
+          else if(plan.m_ranges.size() < Constants::MAX_NON_RESIDENT_RANGES)
+          {
+            SkippedRange range;
+            range.m_start = page;
+            range.m_end   = page + pageSize;
+            plan.m_ranges.push_back(range);
+          }
+          else
+            continue;
+          plan.m_bytes += pageSize;
+        }
+      }
+    }
+    close(fd);
+    return true;
+  }
+
+  /**
+   * @brief Serialize a residency plan as an NT_CDGEN_NON_RESIDENT note descriptor
+   * @details Layout: u32 version, u32 count, u64 skipped bytes, then count SkippedRange entries
+   */
+  inline ArenaVector<char>
+  encodeNonResident(ResidencyPlan const &plan)
+  {
+    std::uint32_t const header[2] = {Constants::NON_RESIDENT_VERSION, static_cast<std::uint32_t>(plan.m_ranges.size())};
+    size_t const rangesOffset     = sizeof(header) + sizeof(plan.m_bytes);
+    ArenaVector<char> desc(rangesOffset + plan.m_ranges.size() * sizeof(SkippedRange));
+    std::memcpy(desc.data(), header, sizeof(header));
+    std::memcpy(desc.data() + sizeof(header), &plan.m_bytes, sizeof(plan.m_bytes));
+    if(!plan.m_ranges.empty())
+      std::memcpy(desc.data() + rangesOffset, plan.m_ranges.data(), plan.m_ranges.size() * sizeof(SkippedRange));
+    return desc;
+  }
+
+  /**
+   * @class RegionReader
+   * @brief Copies the captured regions of a process as one continuous stream
+   *
+   * The PT_LOAD data of a core is the concatenation of the captured regions,
+   * so each read() gathers up to Constants::READ_BATCH_IOVECS region pieces
+   * into a single process_vm_readv() call: thousands of small mappings
+   * (thread stacks, TLS blocks, small heaps) cost a handful of syscalls
+   * instead of one each. Pages that cannot be read (guard pages, truncated
+   * file mappings) are zero-filled and counted while the rest of the batch is
+   * still copied. Ranges from a ResidencyPlan are zero-filled without being
+   * read. Falls back to pread() on /proc/<pid>/mem when process_vm_readv()
+   * is unavailable.
+   *
+   * @note Allocation-free; usable on the crash path
+   */
+  class RegionReader
+  {
+  public:
+    RegionReader(pid_t pid, ArenaVector<MemoryRegion> const &regions) noexcept;
+    ~RegionReader() noexcept;
+    RegionReader(RegionReader const &)            = delete;
+    RegionReader &operator=(RegionReader const &) = delete;
+
+    /**
+     * @brief Copy the next bytes of the stream
+     * @param buffer Destination
+     * @param capacity Size of buffer
+     * @return Bytes stored in buffer, 0 once every captured region was read
+     */
+    size_t read(char *buffer, size_t capacity) noexcept;
+
+    /**
+     * @brief Zero-fill these ranges instead of reading them
+     * @param ranges Sorted ranges (see planResidency()); must outlive the reader
+     */
+    void
+    setSkippedRanges(ArenaVector<SkippedRange> const *ranges) noexcept
+    {
+      m_skipped = ranges;
+    }
+
+    /**
+     * @brief Bytes zero-filled because they could not be read
+     */
+    std::uint64_t
+    getUnreadableBytes() const noexcept
+    {
+      return m_unreadableBytes;
+    }
+
+  private:
+    pid_t m_pid;
+    ArenaVector<MemoryRegion> const &m_regions;
+    ArenaVector<SkippedRange> const *m_skipped = nullptr;
+    size_t m_region                 = 0; ///< Region the stream is in
+    std::uintptr_t m_offset         = 0; ///< Position inside that region
+    size_t m_skip                   = 0; ///< First skipped range not yet passed
+    std::uint64_t m_unreadableBytes = 0;
+    int m_memFd                     = -1; ///< /proc/<pid>/mem fallback when process_vm_readv is unavailable
+    size_t m_pageSize;
+
+    ssize_t _readVector(struct iovec const *local, struct iovec const *remote, size_t count) noexcept;
+  };
+
+  /**
+   * @class ElfCoreWriter
+   * @brief Streams an ELF core of a live process to an output sink
+   *
+   * Layout: ELF header, program headers, note data, page padding, then the
+   * contents of every captured mapping in program-header order. All offsets
+   * are computed up front, so the file is written strictly sequentially.
+   */
+  class ElfCoreWriter
+  {
+  public:
+    ElfCoreWriter(OutputSink &sink, pid_t pid) noexcept;
+    ~ElfCoreWriter() noexcept;
+    ElfCoreWriter(ElfCoreWriter const &)            = delete;
+    ElfCoreWriter &operator=(ElfCoreWriter const &) = delete;
+
+    /**
+     * @brief Write the complete core file
+     * @param map Memory mappings of the target process
+     * @param threads Register state of the captured threads (first is the
+     * crashing/requesting thread)
+     * @param stats Output statistics
+     * @return true if every byte was written, false on I/O failure
+     */
+    bool write(MemoryMap const &map, ThreadList const &threads, CoreDumpStatistics &stats);
+
+    /**
+     * @brief Override the identifiers written into the notes
+     * @param identity Identity of the process the core describes
+     */
+    void
+    setIdentity(ProcessIdentity const &identity) noexcept
+    {
+      m_identity = identity;
+    }
+
+    /**
+     * @brief Append a custom note after the kernel-style notes
+     * @param owner Note owner name (e.g. Constants::NOTE_NAME_CDGEN)
+     * @param type Note type
+     * @param desc Note descriptor
+     */
+    void addNote(char const *owner, std::uint32_t type, ArenaVector<char> desc);
+
+    /**
+     * @brief Read the next batch of memory on a second thread while the current one is written
+     * @details Overlaps process_vm_readv() with compression and disk I/O.
+     * Leave disabled on the crash path: starting a thread allocates.
+     */
+    void
+    setReadAhead(bool enable) noexcept
+    {
+      m_readAhead = enable;
+    }
+
+    /**
+     * @brief Write swapped-out and untouched anonymous pages as zeros without reading them
+     * @details See planResidency(); the ranges are recorded in an NT_CDGEN_NON_RESIDENT note
+     */
+    void
+    setSkipNonResident(bool enable) noexcept
+    {
+      m_skipNonResident = enable;
+    }
+
+  private:
+    struct ExtraNote {
+      char const *m_owner;
+      std::uint32_t m_type;
+      ArenaVector<char> m_desc;
+    };
+
+    OutputSink &m_sink;
+    pid_t m_pid;
+    ProcessIdentity m_identity;
+    bool m_readAhead       = false;
+    bool m_skipNonResident = false;
+    size_t m_pageSize;
+    ArenaVector<char> m_buffer;
+    ArenaVector<ExtraNote> m_extraNotes;
+
+    void _buildNotes(MemoryMap const &map, ThreadList const &threads, ArenaVector<char> &notes) const;
+    static void _appendNote(ArenaVector<char> &notes, char const *owner, std::uint32_t type, void const *desc,
+                            size_t size);
+    bool _writeBuffer(char const *data, size_t size) noexcept;
+    bool _writeMemory(RegionReader &reader, CoreDumpStatistics &stats) noexcept;
+    bool _writeMemoryReadAhead(RegionReader &reader, CoreDumpStatistics &stats);
+  };
+
+  /**
+   * @brief Private writable mapping (stack, heap, anonymous or module data)
+   */
+  inline bool
+  isPrivateWritable(MemoryRegion const &region) noexcept
+  {
+    return (region.m_flags & RegionFlags::WRITE) != 0 && (region.m_flags & RegionFlags::SHARED) == 0;
+  }
+
+  /**
+   * @brief Writable data of a loaded module: its .data mapping or the anonymous .bss right after it
+   */
+  inline bool
+  isModuleData(ArenaVector<MemoryRegion> const &regions, size_t index) noexcept
+  {
+    MemoryRegion const &region = regions[index];
+    if(!isPrivateWritable(region)) return false;
+    if(region.isFileBacked()) return true;
+    return index > 0 && region.m_pathname[0] == '\0' && regions[index - 1].isFileBacked()
+           && regions[index - 1].m_end == region.m_start;
+  }
+
+  /**
+   * @brief Capture priority tiers used by the size-budget planner (lower is more important)
+   */
+  namespace Priority
+  {
+    static constexpr std::uint32_t FAULTING_STACK = 0; ///< Stack of the crashing/requesting thread
+    static constexpr std::uint32_t THREAD_STACK   = 1; ///< Stacks of the other threads
+    static constexpr std::uint32_t MODULE_DATA    = 2; ///< Writable .data/.bss of loaded modules
+    static constexpr std::uint32_t REGISTER_HEAP  = 3; ///< Anonymous memory referenced by registers
+    static constexpr std::uint32_t OTHER          = 4; ///< Everything else, smallest first
+  } // namespace Priority
+
+  /**
+   * @brief Memory range left out of the core by the size-budget planner
+   * @note Layout of the entries of the NT_CDGEN_DROPPED_REGIONS note
+   */
+  struct DroppedRegion {
+    std::uint64_t m_start    = 0;
+    std::uint64_t m_end      = 0;
+    std::uint32_t m_priority = 0;
+    std::uint32_t m_reserved = 0;
+  };
+
+  /**
+   * @brief Result of BudgetPlanner::plan()
+   */
+  struct BudgetPlan {
+    ArenaVector<DroppedRegion> m_dropped;
+    std::uint64_t m_plannedBytes = 0; ///< Memory bytes that will be captured
+    std::uint64_t m_droppedBytes = 0; ///< Memory bytes left out
+  };
+
+  /**
+   * @class BudgetPlanner
+   * @brief Selects the regions that fit into a maximum core size
+   *
+   * Regions are ranked by Priority and admitted greedily until the budget is
+   * used up. Stacks are trimmed to the live part above the stack pointer and
+   * oversized register-referenced regions are reduced to a window around the
+   * referenced address. Everything left out is reported in BudgetPlan so it
+   * can be recorded in the core.
+   */
+  class BudgetPlanner
+  {
+  public:
+    explicit BudgetPlanner(std::uint64_t budget) noexcept : m_budget(budget) {}
+
+    /**
+     * @brief Register a thread stack pointer
+     * @param faulting true for the crashing/requesting thread
+     */
+    void addStackPointer(std::uintptr_t stackPointer, bool faulting);
+
+    /**
+     * @brief Register the general-purpose registers of a thread as heap hints
+     */
+    void addRegisterValues(ThreadState const &thread);
+
+    /**
+     * @brief Rewrite the capture flags (and split regions) of a memory map
+     * @param map Memory map; regions may be split into captured and dropped parts
+     * @param result Receives the dropped ranges and totals
+     */
+    void plan(MemoryMap &map, BudgetPlan &result) const;
+
+  private:
+    std::uint64_t m_budget;
+    AddressList m_stackPointers;
+    std::uintptr_t m_faultingStackPointer = 0;
+    AddressList m_registerValues;
+
+    std::uint64_t _headerReserve(ArenaVector<MemoryRegion> const &regions) const noexcept;
+  };
+
+  /**
+   * @brief Trim a memory map to a maximum core size
+   * @param map Memory map to rewrite
+   * @param threads Captured threads; the first one is the faulting/requesting thread
+   * @param stackPointers Stack pointers of the remaining threads (see readThreadStackPointers())
+   * @param budget Maximum logical core size in bytes (uncompressed)
+   * @param plan Receives the dropped ranges and totals
+   */
+  inline void planSizeBudget(MemoryMap &map, ThreadList const &threads, AddressList const &stackPointers,
+                             std::uint64_t budget, BudgetPlan &plan);
+
+  /**
+   * @brief Serialize a plan as the NT_CDGEN_DROPPED_REGIONS descriptor
+   * @details Layout: u32 version, u32 count, then count DroppedRegion entries
+   */
+  inline ArenaVector<char> encodeDroppedRegions(BudgetPlan const &plan);
+
+  /**
+   * @class CaptureEngine
+   * @brief Selects the mappings whose contents a Linux dump tier writes
+   *
+   * Every mapping keeps its program header so debuggers still see the whole
+   * address space; engines only decide which ones carry contents. Thread
+   * stacks are reduced to their live part above the stack pointer and the
+   * vDSO is always kept (debuggers unwind signal frames through it).
+   * Mappings excluded by the memory filter are never re-enabled.
+   */
+  class CaptureEngine
+  {
+  public:
+    virtual ~CaptureEngine() noexcept = default;
+
+    /**
+     * @brief Apply the tier to a memory map
+     * @param map Memory map to rewrite
+     * @param threads Captured threads (stack pointers taken from their registers)
+     * @param stackPointers Stack pointers of the remaining threads
+     */
+    virtual void select(MemoryMap &map, ThreadList const &threads, AddressList const &stackPointers) const;
+
+  protected:
+    /**
+     * @brief Whether a mapping that is not a thread stack keeps its contents
+     */
+    virtual bool _keep(ArenaVector<MemoryRegion> const &regions, size_t index) const noexcept = 0;
+  };
+
+  /**
+   * @brief CORE_DUMP_STACK_ONLY: registers and live thread stacks
+   */
+  class StackCaptureEngine : public CaptureEngine
+  {
+  protected:
+    bool
+    _keep(ArenaVector<MemoryRegion> const &, size_t) const noexcept override
+    {
+      return false;
+    }
+  };
+
+  /**
+   * @brief CORE_DUMP_STACKS_AND_DATA: thread stacks plus .data/.bss of loaded modules
+   */
+  class StacksAndDataCaptureEngine : public CaptureEngine
+  {
+  protected:
+    bool
+    _keep(ArenaVector<MemoryRegion> const &regions, size_t index) const noexcept override
+    {
+      return isModuleData(regions, index);
+    }
+  };
+
+  /**
+   * @brief CORE_DUMP_HEAP_FILTERED: private writable memory only
+   * @details Stacks, module data, heap and anonymous mappings are written;
+   * code, read-only file mappings and shared memory keep only their headers
+   */
+  class HeapFilteredCaptureEngine : public CaptureEngine
+  {
+  protected:
+    bool
+    _keep(ArenaVector<MemoryRegion> const &regions, size_t index) const noexcept override
+    {
+      return isPrivateWritable(regions[index]);
+    }
+  };
+
+  /**
+   * @brief CORE_DUMP_FULL / CORE_DUMP_COMPRESSED: every readable mapping
+   */
+  class FullCaptureEngine : public CaptureEngine
+  {
+  public:
+    void
+    select(MemoryMap &, ThreadList const &, AddressList const &) const override
+    {}
+
+  protected:
+    bool
+    _keep(ArenaVector<MemoryRegion> const &, size_t) const noexcept override
+    {
+      return true;
+    }
+  };
+
+  /**
+   * @brief Create the capture engine of a UNIX dump type
+   * @return Engine instance, or nullptr for non-UNIX types
+   */
+  inline std::unique_ptr<CaptureEngine> createCaptureEngine(DumpType type);
+
+  /**
+   * @brief Apply the capture tier of a UNIX dump type with a stack-allocated engine
+   * @details Crash-path counterpart of createCaptureEngine(), which allocates
+   */
+  inline void applyCaptureTier(DumpType type, MemoryMap &map, ThreadList const &threads,
+                               AddressList const &stackPointers);
+
+  /**
+   * @brief Reduce an overflowed stack to its innermost and outermost frames
+   * @details A SIGSEGV whose fault address lies just below a private writable
+   * mapping that holds the stack pointer is a stack overflow. The mapping is
+   * fully live by then, so instead of all of it only
+   * Constants::OVERFLOW_INNER_BYTES above the fault (the recursion) and
+   * Constants::OVERFLOW_OUTER_BYTES below the stack top (the entry frames)
+   * keep their contents.
+   * @param map Memory map before the capture tier is applied
+   * @param stackPointer Stack pointer of the faulting thread
+   * @param faultAddress si_addr of the SIGSEGV
+   * @param stackPointers Receives the start of each kept part; the faulting
+   * SP usually lies in the guard area, so these anchors make capture tiers
+   * and the budget planner treat both parts as live stack
+   * @return true if an overflow was detected and the stack was trimmed
+   */
+  inline bool trimOverflowedStack(MemoryMap &map, std::uintptr_t stackPointer, std::uintptr_t faultAddress,
+                                  AddressList &stackPointers);
+
+  // ==================================== CoreDumpEngine Implementation
+  // ==================================== //
+
+  inline void
+  MemoryMap::excludeRange(std::uintptr_t start, std::uintptr_t end)
+  {
+    for(size_t index = 0; index < m_regions.size(); ++index)
+    {
+      MemoryRegion const region = m_regions[index];
+      if(!region.m_capture || region.m_end <= start || region.m_start >= end) continue;
+
+      // Captured head, excluded middle, captured tail; empty parts are dropped
+      MemoryRegion parts[3] = {region, region, region};
+      parts[0].m_end        = std::max(region.m_start, start);
+      parts[1].m_start      = parts[0].m_end;
+      parts[1].m_end        = std::min(region.m_end, end);
+      parts[1].m_capture    = false;
+      parts[2].m_start      = parts[1].m_end;
+      size_t count          = 0;
+      for(size_t part = 0; part < 3; ++part)
+      {
+        parts[part].m_offset = region.m_offset + (parts[part].m_start - region.m_start);
+        if(parts[part].m_end > parts[part].m_start) parts[count++] = parts[part];
+      }
+
+      m_regions[index] = parts[0];
+      m_regions.insert(m_regions.begin() + static_cast<std::ptrdiff_t>(index) + 1, parts + 1, parts + count);
+      index += count - 1;
+    }
+  }
+
+  inline bool
+  MemoryMap::load(pid_t pid, MemoryFilter const *filter)
+  {
+    m_regions.clear();
+    if(!readProcFile(pid, "maps", m_text)) return false;
+    m_text.push_back('\0');
+    _parse(filter);
+    return true;
+  }
+
+  inline void
+  MemoryMap::_parse(MemoryFilter const *filter)
+  {
+    auto const parseHex = [](char *&cursor) -> std::uint64_t
+    {
+      std::uint64_t value = 0;
+      for(;; ++cursor)
+      {
+        char const c = *cursor;
+        if(c >= '0' && c <= '9')
+          value = (value << 4) | static_cast<std::uint64_t>(c - '0');
+        else if(c >= 'a' && c <= 'f')
+          value = (value << 4) | static_cast<std::uint64_t>(c - 'a' + 10);
+        else
+          return value;
+      }
+    };
+
+    char *cursor = m_text.data();
+    while(*cursor != '\0')
+    {
+      char *lineEnd = std::strchr(cursor, '\n');
+      if(lineEnd == nullptr) lineEnd = cursor + std::strlen(cursor);
+      bool const lastLine = (*lineEnd == '\0');
+      *lineEnd            = '\0';
+
+      MemoryRegion region;
+      region.m_start = static_cast<std::uintptr_t>(parseHex(cursor));
+      if(*cursor == '-') ++cursor;
+      region.m_end = static_cast<std::uintptr_t>(parseHex(cursor));
+      while(*cursor == ' ') ++cursor;
+
+      if(cursor[0] == 'r') region.m_flags |= RegionFlags::READ;
+      if(cursor[0] != '\0' && cursor[1] == 'w') region.m_flags |= RegionFlags::WRITE;
+      if(cursor[0] != '\0' && cursor[1] != '\0' && cursor[2] == 'x') region.m_flags |= RegionFlags::EXEC;
+      if(cursor[0] != '\0' && cursor[1] != '\0' && cursor[2] != '\0' && cursor[3] == 's')
+        region.m_flags |= RegionFlags::SHARED;
+      while(*cursor != ' ' && *cursor != '\0') ++cursor;
+      while(*cursor == ' ') ++cursor;
+
+      region.m_offset = parseHex(cursor);
+      while(*cursor == ' ') ++cursor;
+      while(*cursor != ' ' && *cursor != '\0') ++cursor; // device major:minor
+      while(*cursor == ' ') ++cursor;
+
+      while(*cursor >= '0' && *cursor <= '9')
+        region.m_inode = region.m_inode * 10 + static_cast<std::uint64_t>(*cursor++ - '0');
+      while(*cursor == ' ') ++cursor;
+      region.m_pathname = cursor;
+
+      if(region.m_end > region.m_start && std::strcmp(region.m_pathname, "[vsyscall]") != 0)
+      {
+        // Unreadable mappings, vvar pages and the crash arena keep their header but no contents
+        if((region.m_flags & RegionFlags::READ) == 0 || std::strncmp(region.m_pathname, "[vvar", 5) == 0
+           || CrashArena::instance().owns(reinterpret_cast<void const *>(region.m_start)))
+          region.m_capture = false;
+        else if(filter != nullptr && !filter->empty()
+                && !filter->includes(region.m_pathname, region.m_flags, region.isFileBacked(), region.size()))
+          region.m_capture = false;
+        m_regions.push_back(region);
+      }
+
+      if(lastLine) break;
+      cursor = lineEnd + 1;
+    }
+  }
+
+  inline FrameCompressor::FrameCompressor(CompressionCodec codec, int level, size_t frameSize) noexcept
+      : m_codec(codec), m_level(level)
+  {
+    switch(m_codec)
+    {
+      case CompressionCodec::ZSTD:
+#if CORE_DUMP_GENERATOR_HAS_ZSTD
+        m_zstdContext = ZSTD_createCCtx();
+        if(m_zstdContext != nullptr) m_bound = ZSTD_compressBound(frameSize);
+#endif
+        break;
+      case CompressionCodec::LZ4:
+#if CORE_DUMP_GENERATOR_HAS_LZ4
+        if(LZ4F_isError(LZ4F_createCompressionContext(&m_lz4Context, LZ4F_VERSION)))
+        {
+          m_lz4Context = nullptr;
+          break;
+        }
+        m_lz4Preferences.compressionLevel      = m_level;
+        m_lz4Preferences.frameInfo.blockMode   = LZ4F_blockIndependent;
+        m_lz4Preferences.frameInfo.blockSizeID = LZ4F_max4MB;
+        m_bound = LZ4F_compressBound(frameSize, &m_lz4Preferences) + LZ4F_HEADER_SIZE_MAX;
+#endif
+        break;
+    }
+    (void)frameSize;
+  }
+
+  inline FrameCompressor::~FrameCompressor() noexcept
+  {
+#if CORE_DUMP_GENERATOR_HAS_ZSTD
+    if(m_zstdContext != nullptr) ZSTD_freeCCtx(m_zstdContext);
+#endif
+#if CORE_DUMP_GENERATOR_HAS_LZ4
+    if(m_lz4Context != nullptr) LZ4F_freeCompressionContext(m_lz4Context);
+#endif
+  }
+
+  inline size_t
+  FrameCompressor::compress(char const *input, size_t inputSize, char *output, size_t outputCapacity) noexcept
+  {
+    (void)input;
+    (void)inputSize;
+    (void)output;
+    (void)outputCapacity;
+
+    switch(m_codec)
+    {
+      case CompressionCodec::ZSTD:
+      {
+#if CORE_DUMP_GENERATOR_HAS_ZSTD
+        size_t const result = ZSTD_compressCCtx(m_zstdContext, output, outputCapacity, input, inputSize, m_level);
+        return ZSTD_isError(result) ? 0 : result;
+#else
+        return 0;
+#endif
+      }
+      case CompressionCodec::LZ4:
+      {
+#if CORE_DUMP_GENERATOR_HAS_LZ4
+        m_lz4Preferences.frameInfo.contentSize = inputSize;
+        size_t result = LZ4F_compressBegin(m_lz4Context, output, outputCapacity, &m_lz4Preferences);
+        if(LZ4F_isError(result)) return 0;
+        size_t compressedSize = result;
+
+        result = LZ4F_compressUpdate(m_lz4Context, output + compressedSize, outputCapacity - compressedSize, input,
+                                     inputSize, nullptr);
+        if(LZ4F_isError(result)) return 0;
+        compressedSize += result;
+
+        result = LZ4F_compressEnd(m_lz4Context, output + compressedSize, outputCapacity - compressedSize, nullptr);
+        if(LZ4F_isError(result)) return 0;
+        return compressedSize + result;
+#else
+        return 0;
+#endif
+      }
+    }
+    return 0;
+  }
+
+  inline CompressedOutputSink::CompressedOutputSink(int fd, CompressionCodec codec, int level, size_t workerCount,
+                                                    size_t frameSize) noexcept
+      : m_fd(fd), m_codec(codec), m_level(level), m_frameSize(frameSize)
+  {
+    try
+    {
+      // Probe the codec once to size the output buffers
+      m_inlineCompressor.reset(new FrameCompressor(m_codec, m_level, m_frameSize));
+      size_t const bound = m_inlineCompressor->getBound();
+      if(bound == 0) return;
+
+      size_t const frameCount = workerCount == 0 ? 1 : workerCount * 2;
+      for(size_t i = 0; i < frameCount; ++i)
+      {
+        std::unique_ptr<Frame> frame(new Frame());
+        frame->m_input.resize(m_frameSize);
+        frame->m_output.resize(bound);
+        m_freeFrames.push_back(frame.get());
+        m_frames.push_back(std::move(frame));
+      }
+
+      if(workerCount > 0)
+      {
+        try
+        {
+          for(size_t i = 0; i < workerCount; ++i) m_workers.emplace_back(&CompressedOutputSink::_workerLoop, this);
+          m_writer      = std::thread(&CompressedOutputSink::_writerLoop, this);
+          m_workerCount = workerCount;
+        }
+        catch(std::system_error const &)
+        {
+          // Could not start the pipeline: fall back to inline compression
+          _stopThreads();
+        }
+      }
+
+      m_ready = true;
+    }
+    catch(...)
+    {
+      m_ready = false;
+    }
+  }
+
+  inline CompressedOutputSink::~CompressedOutputSink() noexcept
+  {
+    _stopThreads();
+  }
+
+  inline CompressedOutputSink::Frame *
+  CompressedOutputSink::_acquireFrame() noexcept
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_frameFree.wait(lock, [this]() { return !m_freeFrames.empty() || m_failed.load(std::memory_order_acquire); });
+    if(m_freeFrames.empty()) return nullptr;
+
+    Frame *frame = m_freeFrames.back();
+    m_freeFrames.pop_back();
+    frame->m_inputSize = 0;
+    return frame;
+  }
+
+  inline bool
+  CompressedOutputSink::write(void const *data, size_t size) noexcept
+  {
+    if(!m_ready || m_finished) return false;
+
+    auto const *cursor = static_cast<char const *>(data);
+    while(size > 0)
+    {
+      if(m_current == nullptr && (m_current = _acquireFrame()) == nullptr) return false;
+
+      size_t const chunk = std::min(size, m_frameSize - m_current->m_inputSize);
+      std::memcpy(m_current->m_input.data() + m_current->m_inputSize, cursor, chunk);
+      m_current->m_inputSize += chunk;
+      cursor += chunk;
+      size -= chunk;
+      if(m_current->m_inputSize == m_frameSize && !_submitFrame()) return false;
+    }
+    return true;
+  }
+
+  inline bool
+  CompressedOutputSink::_submitFrame() noexcept
+  {
+    Frame *frame      = m_current;
+    m_current         = nullptr;
+    frame->m_sequence = m_nextSequence++;
+
+    if(m_workerCount == 0)
+    {
+      frame->m_outputSize = m_inlineCompressor->compress(frame->m_input.data(), frame->m_inputSize,
+                                                         frame->m_output.data(), frame->m_output.size());
+      bool const emitted = frame->m_outputSize > 0 && _emitFrame(*frame);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_freeFrames.push_back(frame);
+      return emitted;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_pendingFrames.push_back(frame);
+    }
+    m_workAvailable.notify_one();
+    return !m_failed.load(std::memory_order_acquire);
+  }
+
+  inline bool
+  CompressedOutputSink::_emitFrame(Frame const &frame) noexcept
+  {
+    if(!_writeToFd(m_fd, frame.m_output.data(), frame.m_outputSize)) return false;
+    try
+    {
+      m_seekTable.emplace_back(static_cast<std::uint32_t>(frame.m_outputSize),
+                               static_cast<std::uint32_t>(frame.m_inputSize));
+    }
+    catch(...)
+    {
+      return false;
+    }
+    return true;
+  }
+
+  inline void
+  CompressedOutputSink::_workerLoop() noexcept
+  {
+    // Each worker owns its codec context; frames are independent
+    FrameCompressor compressor(m_codec, m_level, m_frameSize);
+
+    for(;;)
+    {
+      Frame *frame = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_workAvailable.wait(lock, [this]() { return m_stopping || !m_pendingFrames.empty(); });
+        if(m_pendingFrames.empty()) return;
+        frame = m_pendingFrames.front();
+        m_pendingFrames.pop_front();
+      }
+
+      frame->m_outputSize = compressor.getBound() == 0 ? 0
+                                                       : compressor.compress(frame->m_input.data(), frame->m_inputSize,
+                                                                             frame->m_output.data(), frame->m_output.size());
+      if(frame->m_outputSize == 0) m_failed.store(true, std::memory_order_release);
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_compressedFrames[frame->m_sequence] = frame;
+      }
+      m_frameReady.notify_all();
+    }
+  }
+
+  inline void
+  CompressedOutputSink::_writerLoop() noexcept
+  {
+    for(;;)
+    {
+      Frame *frame = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_frameReady.wait(lock,
+                          [this]()
+                          {
+                            return m_compressedFrames.count(m_nextToWrite) != 0
+                                   || (m_stopping && m_pendingFrames.empty() && m_compressedFrames.empty());
+                          });
+        auto it = m_compressedFrames.find(m_nextToWrite);
+        if(it == m_compressedFrames.end()) return;
+        frame = it->second;
+        m_compressedFrames.erase(it);
+      }
+
+      // After a failure frames are still drained so the reader never blocks forever
+      if(!m_failed.load(std::memory_order_acquire) && (frame->m_outputSize == 0 || !_emitFrame(*frame)))
+        m_failed.store(true, std::memory_order_release);
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_nextToWrite;
+        m_freeFrames.push_back(frame);
+      }
+      m_frameFree.notify_all();
+      m_frameReady.notify_all();
+    }
+  }
+
+  inline void
+  CompressedOutputSink::_stopThreads() noexcept
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    m_frameReady.notify_all();
+
+    for(auto &worker : m_workers)
+      if(worker.joinable()) worker.join();
+    if(m_writer.joinable()) m_writer.join();
+    m_workers.clear();
+  }
+
+  inline bool
+  CompressedOutputSink::_writeSeekTable() noexcept
+  {
+    // zstd seekable format: skippable frame holding {compressed, decompressed}
+    // sizes per frame, followed by the frame count, descriptor and magic
+    auto const putLe32 = [](std::vector<unsigned char> &out, std::uint32_t value)
+    {
+      for(int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<unsigned char>((value >> shift) & 0xFFU));
+    };
+
+    try
+    {
+      std::vector<unsigned char> table;
+      table.reserve(8 + m_seekTable.size() * 8 + 9);
+      putLe32(table, 0x184D2A5EU);
+      putLe32(table, static_cast<std::uint32_t>(m_seekTable.size() * 8 + 9));
+      for(auto const &entry : m_seekTable)
+      {
+        putLe32(table, entry.first);
+        putLe32(table, entry.second);
+      }
+      putLe32(table, static_cast<std::uint32_t>(m_seekTable.size()));
+      table.push_back(0); // Seek table descriptor: no per-frame checksums
+      putLe32(table, 0x8F92EAB1U);
+      return _writeToFd(m_fd, table.data(), table.size());
+    }
+    catch(...)
+    {
+      return false;
+    }
+  }
+
+  inline bool
+  CompressedOutputSink::finish() noexcept
+  {
+    if(!m_ready || m_finished) return false;
+    m_finished = true;
+
+    bool success = true;
+    if(m_current != nullptr)
+    {
+      if(m_current->m_inputSize > 0)
+        success = _submitFrame();
+      else
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_freeFrames.push_back(m_current);
+        m_current = nullptr;
+      }
+    }
+
+    if(m_workerCount > 0)
+    {
+      // Wait until the writer has emitted every submitted frame
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_frameFree.wait(lock, [this]() { return m_nextToWrite == m_nextSequence || m_failed.load(); });
+    }
+    _stopThreads();
+
+    return success && !m_failed.load(std::memory_order_acquire) && _writeSeekTable();
+  }
+
+  inline RegionReader::RegionReader(pid_t pid, ArenaVector<MemoryRegion> const &regions) noexcept
+      : m_pid(pid), m_regions(regions), m_pageSize(static_cast<size_t>(sysconf(_SC_PAGESIZE)))
+  {}
+
+  inline RegionReader::~RegionReader() noexcept
+  {
+    if(m_memFd >= 0) close(m_memFd);
+  }
+
+  inline ssize_t
+  RegionReader::_readVector(struct iovec const *local, struct iovec const *remote, size_t count) noexcept
+  {
+    for(;;)
+    {
+      if(m_memFd < 0)
+      {
+        auto const vectors      = static_cast<unsigned long>(count);
+        ssize_t const bytesRead = process_vm_readv(m_pid, local, vectors, remote, vectors, 0);
+        if(bytesRead >= 0) return bytesRead;
+        if(errno == EINTR) continue;
+
+        // Kernels without CMA or sandboxes that filter the syscall: use /proc/<pid>/mem
+        if(errno != ENOSYS && errno != EPERM) return -1;
+        char path[64];
+        formatProcPath(path, sizeof(path), m_pid, "mem");
+        m_memFd = open(path, O_RDONLY | O_CLOEXEC);
+        if(m_memFd < 0) return -1;
+      }
+
+      // pread() has no gather form across remote addresses: one piece per call
+      ssize_t const bytesRead = pread(m_memFd, local[0].iov_base, local[0].iov_len,
+                                      static_cast<off_t>(reinterpret_cast<std::uintptr_t>(remote[0].iov_base)));
+      if(bytesRead >= 0 || errno != EINTR) return bytesRead;
+    }
+  }
+
+  inline size_t
+  RegionReader::read(char *buffer, size_t capacity) noexcept
+  {
+    // Gather the next pieces of the stream; local and remote vectors are split identically
+    struct iovec local[Constants::READ_BATCH_IOVECS];
+    struct iovec remote[Constants::READ_BATCH_IOVECS];
+    size_t count  = 0;
+    size_t filled = 0;
+    while(count < Constants::READ_BATCH_IOVECS && filled < capacity && m_region < m_regions.size())
+    {
+      MemoryRegion const &region = m_regions[m_region];
+      if(!region.m_capture || m_offset >= region.size())
+      {
+        ++m_region;
+        m_offset = 0;
+        continue;
+      }
+
+      std::uintptr_t const address = region.m_start + m_offset;
+      size_t piece                 = std::min(static_cast<size_t>(region.size() - m_offset), capacity - filled);
+      while(m_skipped != nullptr && m_skip < m_skipped->size() && (*m_skipped)[m_skip].m_end <= address) ++m_skip;
+      SkippedRange const *skip = (m_skipped != nullptr && m_skip < m_skipped->size()) ? &(*m_skipped)[m_skip] : nullptr;
+      if(skip != nullptr && skip->m_start <= address)
+      {
+        piece = std::min(piece, static_cast<size_t>(skip->m_end - address));
+        std::memset(buffer + filled, 0, piece);
+      }
+      else
+      {
+        if(skip != nullptr) piece = std::min(piece, static_cast<size_t>(skip->m_start - address));
+        local[count].iov_base  = buffer + filled;
+        local[count].iov_len   = piece;
+        remote[count].iov_base = reinterpret_cast<void *>(address);
+        remote[count].iov_len  = piece;
+        ++count;
+      }
+      filled += piece;
+      m_offset += piece;
+    }
+
+    // Copy the batch, resuming after short reads
+    size_t index = 0;
+    while(index < count)
+    {
+      ssize_t bytesRead = _readVector(local + index, remote + index, count - index);
+      if(bytesRead <= 0)
+      {
+        // Nothing copied at the head of the batch: retry its first page alone, zero-fill what fails
+        auto const address       = reinterpret_cast<std::uintptr_t>(remote[index].iov_base);
+        size_t const step        = std::min(m_pageSize - address % m_pageSize, remote[index].iov_len);
+        struct iovec const page  = {local[index].iov_base, step};
+        struct iovec const probe = {remote[index].iov_base, step};
+        ssize_t const pageRead   = _readVector(&page, &probe, 1);
+        size_t const copied      = pageRead > 0 ? static_cast<size_t>(pageRead) : 0;
+        std::memset(static_cast<char *>(local[index].iov_base) + copied, 0, step - copied);
+        m_unreadableBytes += step - copied;
+        bytesRead = static_cast<ssize_t>(step);
+      }
+
+      // Advance both vectors past the copied bytes
+      auto remaining = static_cast<size_t>(bytesRead);
+      while(remaining > 0 && index < count)
+      {
+        size_t const step      = std::min(remaining, remote[index].iov_len);
+        local[index].iov_base  = static_cast<char *>(local[index].iov_base) + step;
+        local[index].iov_len  -= step;
+        remote[index].iov_base = static_cast<char *>(remote[index].iov_base) + step;
+        remote[index].iov_len -= step;
+        remaining -= step;
+        if(remote[index].iov_len == 0) ++index;
+      }
+    }
+    return filled;
+  }
+
+  inline ElfCoreWriter::ElfCoreWriter(OutputSink &sink, pid_t pid) noexcept
+      : m_sink(sink), m_pid(pid), m_identity(ProcessIdentity::current()),
+        m_pageSize(static_cast<size_t>(sysconf(_SC_PAGESIZE)))
+  {}
+
+  inline ElfCoreWriter::~ElfCoreWriter() noexcept = default;
+
+  inline void
+  ElfCoreWriter::addNote(char const *owner, std::uint32_t type, ArenaVector<char> desc)
+  {
+    ExtraNote note;
+    note.m_owner = owner;
+    note.m_type  = type;
+    note.m_desc.swap(desc);
+    m_extraNotes.push_back(std::move(note));
+  }
+
+  inline void
+  ElfCoreWriter::_appendNote(ArenaVector<char> &notes, char const *owner, std::uint32_t type, void const *desc,
+                             size_t size)
+  {
+    auto const align = [](size_t value)
+    { return (value + Constants::NOTE_ALIGNMENT - 1) & ~(Constants::NOTE_ALIGNMENT - 1); };
+
+    size_t const nameSize = std::strlen(owner) + 1;
+    ElfW(Nhdr) header;
+    header.n_namesz     = static_cast<std::uint32_t>(nameSize);
+    header.n_descsz     = static_cast<std::uint32_t>(size);
+    header.n_type       = type;
+
+    size_t const offset = notes.size();
+    notes.resize(offset + sizeof(header) + align(nameSize) + align(size), 0);
+    std::memcpy(notes.data() + offset, &header, sizeof(header));
+    std::memcpy(notes.data() + offset + sizeof(header), owner, nameSize);
+    if(size > 0) std::memcpy(notes.data() + offset + sizeof(header) + align(nameSize), desc, size);
+  }
+
+  inline void
+  ElfCoreWriter::_buildNotes(MemoryMap const &map, ThreadList const &threads, ArenaVector<char> &notes) const
+  {
+    ArenaVector<char> scratch;
+
+    for(size_t index = 0; index < threads.size(); ++index)
+    {
+      ThreadState const &thread = threads[index];
+
+      elf_prstatus status;
+      std::memset(&status, 0, sizeof(status));
+      status.pr_info.si_signo = thread.m_signal;
+      status.pr_cursig        = static_cast<short>(thread.m_signal);
+      status.pr_pid           = thread.m_tid;
+      status.pr_ppid          = m_identity.m_ppid;
+      status.pr_pgrp          = m_identity.m_pgrp;
+      status.pr_sid           = m_identity.m_sid;
+      std::memcpy(&status.pr_reg, &thread.m_registers, sizeof(status.pr_reg));
+      status.pr_fpvalid = thread.m_hasFpRegisters ? 1 : 0;
+      _appendNote(notes, Constants::NOTE_NAME_CORE, NT_PRSTATUS, &status, sizeof(status));
+
+      // Process-wide notes follow the first thread, as in kernel-written cores
+      if(index == 0)
+      {
+        elf_prpsinfo info;
+        std::memset(&info, 0, sizeof(info));
+        info.pr_sname = 'R';
+        info.pr_uid   = getuid();
+        info.pr_gid   = getgid();
+        info.pr_pid   = m_identity.m_pid;
+        info.pr_ppid  = m_identity.m_ppid;
+        info.pr_pgrp  = m_identity.m_pgrp;
+        info.pr_sid   = m_identity.m_sid;
+
+        if(readProcFile(m_pid, "comm", scratch) && !scratch.empty())
+        {
+          size_t length = std::min(scratch.size(), sizeof(info.pr_fname) - 1);
+          if(length > 0 && scratch[length - 1] == '\n') --length;
+          std::memcpy(info.pr_fname, scratch.data(), length);
+        }
+        if(readProcFile(m_pid, "cmdline", scratch) && !scratch.empty())
+        {
+          size_t const length = std::min(scratch.size(), sizeof(info.pr_psargs) - 1);
+          for(size_t i = 0; i < length; ++i) info.pr_psargs[i] = scratch[i] == '\0' ? ' ' : scratch[i];
+        }
+        _appendNote(notes, Constants::NOTE_NAME_CORE, NT_PRPSINFO, &info, sizeof(info));
+
+        if(readProcFile(m_pid, "auxv", scratch) && !scratch.empty())
+          _appendNote(notes, Constants::NOTE_NAME_CORE, NT_AUXV, scratch.data(), scratch.size());
+
+        // NT_FILE: count, page size, {start, end, page offset}[count], names
+        ArenaVector<long> table(2, 0);
+        ArenaVector<char> names;
+        for(auto const &region : map.getRegions())
+        {
+          if(!region.isFileBacked()) continue;
+          table.push_back(static_cast<long>(region.m_start));
+          table.push_back(static_cast<long>(region.m_end));
+          table.push_back(static_cast<long>(region.m_offset / m_pageSize));
+          names.insert(names.end(), region.m_pathname, region.m_pathname + std::strlen(region.m_pathname) + 1);
+          ++table[0];
+        }
+        table[1] = static_cast<long>(m_pageSize);
+        scratch.resize(table.size() * sizeof(long) + names.size());
+        std::memcpy(scratch.data(), table.data(), table.size() * sizeof(long));
+        if(!names.empty()) std::memcpy(scratch.data() + table.size() * sizeof(long), names.data(), names.size());
+        _appendNote(notes, Constants::NOTE_NAME_CORE, NT_FILE, scratch.data(), scratch.size());
+      }
+
+      if(thread.m_hasFpRegisters)
+        _appendNote(notes, Constants::NOTE_NAME_CORE, NT_FPREGSET, &thread.m_fpRegisters, sizeof(thread.m_fpRegisters));
+    }
+
+    for(auto const &note : m_extraNotes)
+      _appendNote(notes, note.m_owner, note.m_type, note.m_desc.data(), note.m_desc.size());
+  }
+
+  inline bool
+  ElfCoreWriter::_writeBuffer(char const *data, size_t size) noexcept
+  {
+    return m_sink.supportsHoles() ? writeSparse(m_sink, data, size, m_pageSize) : m_sink.write(data, size);
+  }
+
+  inline bool
+  ElfCoreWriter::_writeMemory(RegionReader &reader, CoreDumpStatistics &stats) noexcept
+  {
+    if(m_readAhead)
+    {
+      try
+      {
+        return _writeMemoryReadAhead(reader, stats);
+      }
+      catch(std::exception const &)
+      {
+        // No thread or buffer before any byte was read: copy on this thread instead
+      }
+    }
+
+    for(;;)
+    {
+      size_t const length = reader.read(m_buffer.data(), m_buffer.size());
+      if(length == 0) break;
+      if(!_writeBuffer(m_buffer.data(), length)) return false;
+      stats.m_memoryBytes += length;
+    }
+    stats.m_unreadableBytes = reader.getUnreadableBytes();
+    return true;
+  }
+
+  inline bool
+  ElfCoreWriter::_writeMemoryReadAhead(RegionReader &reader, CoreDumpStatistics &stats)
+  {
+    // Double buffering: the reader thread fills one buffer while this thread writes the other
+    ArenaVector<char> spare(m_buffer.size());
+    char *const buffers[2] = {m_buffer.data(), spare.data()};
+    size_t lengths[2]      = {0, 0};
+    bool full[2]           = {false, false};
+    bool stop              = false;
+    std::mutex mutex;
+    std::condition_variable changed;
+
+    std::thread readerThread(
+      [&]()
+      {
+        for(size_t slot = 0;; slot ^= 1)
+        {
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&]() { return !full[slot] || stop; });
+            if(stop) return;
+          }
+          size_t const length = reader.read(buffers[slot], m_buffer.size());
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            lengths[slot] = length;
+            full[slot]    = true;
+          }
+          changed.notify_all();
+          if(length == 0) return;
+        }
+      });
+
+    bool written = true;
+    for(size_t slot = 0;; slot ^= 1)
+    {
+      size_t length = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&]() { return full[slot]; });
+        length = lengths[slot];
+      }
+      if(length == 0) break;
+
+      written = _writeBuffer(buffers[slot], length);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        full[slot] = false;
+        stop       = !written;
+      }
+      changed.notify_all();
+      if(!written) break;
+      stats.m_memoryBytes += length;
+    }
+
+    readerThread.join();
+    stats.m_unreadableBytes = reader.getUnreadableBytes();
+    return written;
+  }
+
+  inline bool
+  ElfCoreWriter::write(MemoryMap const &map, ThreadList const &threads, CoreDumpStatistics &stats)
+  {
+    stats = CoreDumpStatistics{};
+
+    // Size the copy buffer to the captured total so small cores stay cheap
+    ArenaVector<MemoryRegion> const &regions = map.getRegions();
+    size_t bufferSize                        = 0;
+    for(auto const &region : regions)
+      if(region.m_capture) bufferSize = std::min(bufferSize + region.size(), Constants::COPY_CHUNK_SIZE);
+    m_buffer.resize(bufferSize);
+
+    // Decided before the notes are built so the skipped ranges can be recorded
+    ResidencyPlan residency;
+    if(m_skipNonResident && planResidency(m_pid, map, residency))
+    {
+      addNote(Constants::NOTE_NAME_CDGEN, Constants::NT_CDGEN_NON_RESIDENT, encodeNonResident(residency));
+      stats.m_nonResidentBytes = residency.m_bytes;
+    }
+
+    ArenaVector<char> notes;
+    _buildNotes(map, threads, notes);
+
+    // More than 0xFFFF program headers are signalled through section header 0 (PN_XNUM)
+    size_t const phdrCount        = regions.size() + 1;
+    bool const extendedNumbering  = phdrCount >= PN_XNUM;
+    size_t const headerSize       = sizeof(ElfW(Ehdr)) + phdrCount * sizeof(ElfW(Phdr))
+                              + (extendedNumbering ? sizeof(ElfW(Shdr)) : 0);
+    size_t const notesOffset      = headerSize;
+    size_t const dataOffset       = (notesOffset + notes.size() + m_pageSize - 1) & ~(m_pageSize - 1);
+
+    ArenaVector<char> header(headerSize, 0);
+    auto *ehdr                    = reinterpret_cast<ElfW(Ehdr) *>(header.data());
+    std::memcpy(ehdr->e_ident, ELFMAG, SELFMAG);
+    ehdr->e_ident[EI_CLASS]       = sizeof(void *) == 8 ? ELFCLASS64 : ELFCLASS32;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    ehdr->e_ident[EI_DATA] = ELFDATA2LSB;
+#else
+    ehdr->e_ident[EI_DATA] = ELFDATA2MSB;
+#endif
+    ehdr->e_ident[EI_VERSION] = EV_CURRENT;
+    ehdr->e_ident[EI_OSABI]   = ELFOSABI_NONE;
+    ehdr->e_type              = ET_CORE;
+#if defined(__x86_64__)
+    ehdr->e_machine = EM_X86_64;
+#elif defined(__aarch64__)
+    ehdr->e_machine = EM_AARCH64;
+#elif defined(__i386__)
+    ehdr->e_machine = EM_386;
+#elif defined(__arm__)
+    ehdr->e_machine = EM_ARM;
+#else
+    ehdr->e_machine = EM_NONE;
+#endif
+    ehdr->e_version   = EV_CURRENT;
+    ehdr->e_phoff     = sizeof(ElfW(Ehdr));
+    ehdr->e_ehsize    = sizeof(ElfW(Ehdr));
+    ehdr->e_phentsize = sizeof(ElfW(Phdr));
+    ehdr->e_phnum     = static_cast<ElfW(Half)>(extendedNumbering ? PN_XNUM : phdrCount);
+    if(extendedNumbering)
+    {
+      ehdr->e_shoff     = sizeof(ElfW(Ehdr)) + phdrCount * sizeof(ElfW(Phdr));
+      ehdr->e_shentsize = sizeof(ElfW(Shdr));
+      ehdr->e_shnum     = 1;
+      auto *shdr        = reinterpret_cast<ElfW(Shdr) *>(header.data() + ehdr->e_shoff);
+      shdr->sh_info     = static_cast<ElfW(Word)>(phdrCount);
+    }
+
+    auto *phdr     = reinterpret_cast<ElfW(Phdr) *>(header.data() + sizeof(ElfW(Ehdr)));
+    phdr->p_type   = PT_NOTE;
+    phdr->p_offset = notesOffset;
+    phdr->p_filesz = notes.size();
+
+    std::uint64_t offset = dataOffset;
+    for(size_t index = 0; index < regions.size(); ++index)
+    {
+      MemoryRegion const &region = regions[index];
+      ElfW(Phdr) &segment        = phdr[index + 1];
+      segment.p_type             = PT_LOAD;
+      segment.p_offset           = offset;
+      segment.p_vaddr            = region.m_start;
+      segment.p_memsz            = region.size();
+      segment.p_filesz           = region.m_capture ? region.size() : 0;
+      segment.p_align            = m_pageSize;
+      segment.p_flags            = ((region.m_flags & RegionFlags::READ) != 0 ? PF_R : 0U)
+                        | ((region.m_flags & RegionFlags::WRITE) != 0 ? PF_W : 0U)
+                        | ((region.m_flags & RegionFlags::EXEC) != 0 ? PF_X : 0U);
+      offset += segment.p_filesz;
+
+      ++stats.m_segmentCount;
+      if(region.m_capture) ++stats.m_capturedSegments;
+    }
+
+    if(!m_sink.write(header.data(), header.size()) || !m_sink.write(notes.data(), notes.size())
+       || !m_sink.skip(dataOffset - notesOffset - notes.size()))
+      return false;
+
+    RegionReader reader(m_pid, regions);
+    reader.setSkippedRanges(&residency.m_ranges);
+    if(!_writeMemory(reader, stats)) return false;
+
+    if(!m_sink.finish()) return false;
+
+    stats.m_threadCount  = threads.size();
+    stats.m_fileSize     = offset;
+    stats.m_bytesWritten = m_sink.getBytesWritten();
+    stats.m_holeBytes    = m_sink.getHoleBytes();
+    return true;
+  }
+
+  inline void
+  BudgetPlanner::addStackPointer(std::uintptr_t stackPointer, bool faulting)
+  {
+    if(faulting) m_faultingStackPointer = stackPointer;
+    m_stackPointers.push_back(stackPointer);
+  }
+
+  inline void
+  BudgetPlanner::addRegisterValues(ThreadState const &thread)
+  {
+    auto const *registers = reinterpret_cast<unsigned long const *>(&thread.m_registers);
+    size_t const count    = sizeof(thread.m_registers) / sizeof(unsigned long);
+    for(size_t index = 0; index < count; ++index)
+      if(registers[index] >= Constants::HEAP_WINDOW) m_registerValues.push_back(registers[index]);
+  }
+
+  inline std::uint64_t
+  BudgetPlanner::_headerReserve(ArenaVector<MemoryRegion> const &regions) const noexcept
+  {
+    // A region may be split in three program headers and two dropped-range entries
+    std::uint64_t reserve = Constants::BUDGET_HEADER_RESERVE;
+    for(auto const &region : regions)
+    {
+      reserve += 3 * sizeof(ElfW(Phdr)) + 2 * sizeof(DroppedRegion);
+      if(region.isFileBacked()) reserve += 3 * sizeof(std::uint64_t) + std::strlen(region.m_pathname) + 1; // NT_FILE
+    }
+    std::uint64_t const perThread = sizeof(elf_prstatus) + sizeof(elf_fpregset_t) + 2 * sizeof(ElfW(Nhdr)) + 16;
+    return reserve + (m_stackPointers.size() + 1) * perThread;
+  }
+
+  inline void
+  BudgetPlanner::plan(MemoryMap &map, BudgetPlan &result) const
+  {
+    result = BudgetPlan{};
+    ArenaVector<MemoryRegion> &regions = map.getRegions();
+    size_t const pageSize              = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto const pageDown                = [pageSize](std::uintptr_t value) { return value & ~(pageSize - 1); };
+    auto const pageUp = [pageSize](std::uintptr_t value) { return (value + pageSize - 1) & ~(pageSize - 1); };
+
+    struct Candidate {
+      size_t m_index;
+      std::uint32_t m_priority;
+      std::uintptr_t m_start; ///< Preferred capture range
+      std::uintptr_t m_end;
+      std::uintptr_t m_hint; ///< Register value for window trimming (REGISTER_HEAP)
+    };
+
+    ArenaVector<Candidate> candidates;
+    for(size_t index = 0; index < regions.size(); ++index)
+    {
+      MemoryRegion const &region = regions[index];
+      if(!region.m_capture) continue;
+
+      Candidate candidate{index, Priority::OTHER, region.m_start, region.m_end, 0};
+      bool const writablePrivate = isPrivateWritable(region);
+
+      for(std::uintptr_t stackPointer : m_stackPointers)
+      {
+        if(stackPointer < region.m_start || stackPointer >= region.m_end) continue;
+        // Stacks grow down: only [SP - red zone, end) is live
+        candidate.m_priority = stackPointer == m_faultingStackPointer ? Priority::FAULTING_STACK
+                                                                      : Priority::THREAD_STACK;
+        std::uintptr_t const low = stackPointer > region.m_start + Constants::STACK_RED_ZONE
+                                     ? stackPointer - Constants::STACK_RED_ZONE
+                                     : region.m_start;
+        candidate.m_start = std::max(region.m_start, pageDown(low));
+        break;
+      }
+
+      if(candidate.m_priority == Priority::OTHER && std::strcmp(region.m_pathname, "[stack]") == 0)
+        candidate.m_priority = Priority::THREAD_STACK;
+
+      if(candidate.m_priority == Priority::OTHER && isModuleData(regions, index))
+        candidate.m_priority = Priority::MODULE_DATA;
+
+      if(candidate.m_priority == Priority::OTHER && writablePrivate)
+      {
+        for(std::uintptr_t value : m_registerValues)
+        {
+          if(value < region.m_start || value >= region.m_end) continue;
+          candidate.m_priority = Priority::REGISTER_HEAP;
+          candidate.m_hint     = value;
+          break;
+        }
+      }
+
+      candidates.push_back(candidate);
+    }
+
+    // Index tiebreak instead of std::stable_sort, whose merge buffer would bypass the crash arena
+    std::sort(candidates.begin(), candidates.end(),
+              [](Candidate const &left, Candidate const &right)
+              {
+                if(left.m_priority != right.m_priority) return left.m_priority < right.m_priority;
+                if(left.m_priority == Priority::OTHER && left.m_end - left.m_start != right.m_end - right.m_start)
+                  return left.m_end - left.m_start < right.m_end - right.m_start;
+                return left.m_index < right.m_index;
+              });
+
+    // Decide the captured range [first, second) of every candidate region
+    ArenaVector<std::pair<std::uintptr_t, std::uintptr_t>> captured(regions.size());
+    ArenaVector<std::uint32_t> priorities(regions.size(), Priority::OTHER);
+    std::uint64_t const reserve = _headerReserve(regions);
+    std::uint64_t remaining     = m_budget > reserve ? m_budget - reserve : 0;
+    for(auto const &candidate : candidates)
+    {
+      priorities[candidate.m_index] = candidate.m_priority;
+      std::uintptr_t start          = candidate.m_start;
+      std::uintptr_t end            = candidate.m_end;
+
+      if(end - start > remaining && candidate.m_priority == Priority::REGISTER_HEAP)
+      {
+        std::uintptr_t const window = std::min<std::uintptr_t>(candidate.m_hint, Constants::HEAP_WINDOW);
+        start                       = std::max(start, pageDown(candidate.m_hint - window));
+        end                         = std::min(end, pageUp(candidate.m_hint + Constants::HEAP_WINDOW));
+      }
+      if(end - start > remaining && candidate.m_priority <= Priority::THREAD_STACK)
+        end = start + pageDown(static_cast<std::uintptr_t>(remaining)); // Keep the frames nearest to SP
+      if(end <= start || end - start > remaining) continue;
+
+      captured[candidate.m_index] = std::make_pair(start, end);
+      remaining -= end - start;
+      result.m_plannedBytes += end - start;
+    }
+
+    // Rebuild the region list, splitting partially captured regions
+    ArenaVector<MemoryRegion> planned;
+    planned.reserve(regions.size() + candidates.size() * 2);
+    auto const emit = [&planned, &result](MemoryRegion const &source, std::uintptr_t start, std::uintptr_t end,
+                                          bool capture, std::uint32_t priority, bool dropped)
+    {
+      if(end <= start) return;
+      MemoryRegion part = source;
+      part.m_start      = start;
+      part.m_end        = end;
+      part.m_offset     = source.m_offset + (start - source.m_start);
+      part.m_capture    = capture;
+      planned.push_back(part);
+
+      if(!dropped) return;
+      DroppedRegion entry;
+      entry.m_start    = start;
+      entry.m_end      = end;
+      entry.m_priority = priority;
+      result.m_dropped.push_back(entry);
+      result.m_droppedBytes += end - start;
+    };
+
+    for(size_t index = 0; index < regions.size(); ++index)
+    {
+      MemoryRegion const &region = regions[index];
+      if(!region.m_capture)
+      {
+        planned.push_back(region); // Unreadable or filtered out before planning
+        continue;
+      }
+
+      std::uintptr_t const start = captured[index].first;
+      std::uintptr_t const end   = captured[index].second;
+      if(end <= start)
+      {
+        emit(region, region.m_start, region.m_end, false, priorities[index], true);
+        continue;
+      }
+      emit(region, region.m_start, start, false, priorities[index], true);
+      emit(region, start, end, true, priorities[index], false);
+      emit(region, end, region.m_end, false, priorities[index], true);
+    }
+
+    regions.swap(planned);
+  }
+
+  inline void
+  planSizeBudget(MemoryMap &map, ThreadList const &threads, AddressList const &stackPointers, std::uint64_t budget,
+                 BudgetPlan &plan)
+  {
+    BudgetPlanner planner(budget);
+    for(size_t index = 0; index < threads.size(); ++index)
+    {
+      planner.addStackPointer(stackPointerOf(threads[index]), index == 0);
+      planner.addRegisterValues(threads[index]);
+    }
+    for(std::uintptr_t stackPointer : stackPointers) planner.addStackPointer(stackPointer, false);
+
+    planner.plan(map, plan);
+  }
+
+  inline ArenaVector<char>
+  encodeDroppedRegions(BudgetPlan const &plan)
+  {
+    std::uint32_t const header[2] = {Constants::DROPPED_REGIONS_VERSION,
+                                     static_cast<std::uint32_t>(plan.m_dropped.size())};
+    ArenaVector<char> desc(sizeof(header) + plan.m_dropped.size() * sizeof(DroppedRegion));
+    std::memcpy(desc.data(), header, sizeof(header));
+    if(!plan.m_dropped.empty())
+      std::memcpy(desc.data() + sizeof(header), plan.m_dropped.data(), plan.m_dropped.size() * sizeof(DroppedRegion));
+    return desc;
+  }
+
+  inline void
+  CaptureEngine::select(MemoryMap &map, ThreadList const &threads, AddressList const &stackPointers) const
+  {
+    ArenaVector<MemoryRegion> &regions = map.getRegions();
+    size_t const pageSize              = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    AddressList allStackPointers(stackPointers);
+    for(auto const &thread : threads) allStackPointers.push_back(stackPointerOf(thread));
+
+    ArenaVector<MemoryRegion> selected;
+    selected.reserve(regions.size() + allStackPointers.size());
+    for(size_t index = 0; index < regions.size(); ++index)
+    {
+      MemoryRegion region = regions[index];
+      if(!region.m_capture)
+      {
+        selected.push_back(region);
+        continue;
+      }
+
+      // Lowest live stack address of any thread whose SP lies in this mapping
+      std::uintptr_t liveStart = region.m_end;
+      for(std::uintptr_t stackPointer : allStackPointers)
+      {
+        if(stackPointer < region.m_start || stackPointer >= region.m_end) continue;
+        std::uintptr_t const low = stackPointer - std::min<std::uintptr_t>(stackPointer - region.m_start,
+                                                                           Constants::STACK_RED_ZONE);
+        liveStart                = std::min(liveStart, static_cast<std::uintptr_t>(low & ~(pageSize - 1)));
+      }
+
+      if(liveStart < region.m_end && liveStart > region.m_start)
+      {
+        // Header-only part below the stack pointer, contents above it
+        MemoryRegion dead = region;
+        dead.m_end        = liveStart;
+        dead.m_capture    = false;
+        selected.push_back(dead);
+
+        region.m_offset += liveStart - region.m_start;
+        region.m_start = liveStart;
+      }
+      else if(liveStart == region.m_end && std::strcmp(region.m_pathname, "[stack]") != 0
+              && std::strcmp(region.m_pathname, "[vdso]") != 0)
+        region.m_capture = _keep(regions, index);
+
+      selected.push_back(region);
+    }
+
+    regions.swap(selected);
+  }
+
+  inline std::unique_ptr<CaptureEngine>
+  createCaptureEngine(DumpType type)
+  {
+    switch(type)
+    {
+    case DumpType::CORE_DUMP_STACK_ONLY:      return std::unique_ptr<CaptureEngine>(new StackCaptureEngine());
+    case DumpType::CORE_DUMP_STACKS_AND_DATA: return std::unique_ptr<CaptureEngine>(new StacksAndDataCaptureEngine());
+    case DumpType::CORE_DUMP_HEAP_FILTERED:   return std::unique_ptr<CaptureEngine>(new HeapFilteredCaptureEngine());
+    case DumpType::CORE_DUMP_COMPRESSED:
+    case DumpType::CORE_DUMP_FULL:            return std::unique_ptr<CaptureEngine>(new FullCaptureEngine());
+    default:                                  return nullptr;
+    }
+  }
+
+  inline void
+  applyCaptureTier(DumpType type, MemoryMap &map, ThreadList const &threads, AddressList const &stackPointers)
+  {
+    switch(type)
+    {
+    case DumpType::CORE_DUMP_STACK_ONLY:      StackCaptureEngine().select(map, threads, stackPointers); break;
+    case DumpType::CORE_DUMP_STACKS_AND_DATA: StacksAndDataCaptureEngine().select(map, threads, stackPointers); break;
+    case DumpType::CORE_DUMP_HEAP_FILTERED:   HeapFilteredCaptureEngine().select(map, threads, stackPointers); break;
+    default:                                  break; // Full capture
+    }
+  }
+
+  inline bool
+  trimOverflowedStack(MemoryMap &map, std::uintptr_t stackPointer, std::uintptr_t faultAddress,
+                      AddressList &stackPointers)
+  {
+    ArenaVector<MemoryRegion> &regions = map.getRegions();
+    size_t const pageSize              = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    // The stack is the lowest captured private writable mapping above the fault that the
+    // stack pointer has not left (the SP may already point into the guard area)
+    size_t index = 0;
+    while(index < regions.size() && regions[index].m_end <= faultAddress) ++index;
+    if(index == regions.size()) return false;
+    if(faultAddress >= regions[index].m_start && regions[index].m_capture) return false; // Ordinary bad access
+    while(index < regions.size() && !regions[index].m_capture) ++index;
+    if(index == regions.size()) return false;
+
+    MemoryRegion const stack = regions[index];
+    if(!isPrivateWritable(stack) || stack.m_start - faultAddress > Constants::OVERFLOW_GUARD_GAP
+       || stackPointer >= stack.m_end || stackPointer + Constants::OVERFLOW_GUARD_GAP < stack.m_start)
+      return false;
+    if(stack.size() <= Constants::OVERFLOW_INNER_BYTES + Constants::OVERFLOW_OUTER_BYTES)
+    {
+      stackPointers.push_back(stack.m_start);
+      return true;
+    }
+
+    std::uintptr_t const innerEnd   = (stack.m_start + Constants::OVERFLOW_INNER_BYTES) & ~(pageSize - 1);
+    std::uintptr_t const outerStart = (stack.m_end - Constants::OVERFLOW_OUTER_BYTES) & ~(pageSize - 1);
+    MemoryRegion parts[3] = {stack, stack, stack};
+    parts[0].m_end        = innerEnd;
+    parts[1].m_start      = innerEnd;
+    parts[1].m_end        = outerStart;
+    parts[1].m_capture    = false;
+    parts[2].m_start      = outerStart;
+    for(auto &part : parts) part.m_offset = stack.m_offset + (part.m_start - stack.m_start);
+
+    regions[index] = parts[0];
+    regions.insert(regions.begin() + static_cast<std::ptrdiff_t>(index) + 1, parts + 1, parts + 3);
+    stackPointers.push_back(parts[0].m_start);
+    stackPointers.push_back(parts[2].m_start);
+    return true;
+  }
+} // namespace CoreDumpEngine
+#endif // DUMP_CREATOR_UNIX
+
+/**
+ * @enum ReadinessState
+ * @brief Progress of CoreDumpGenerator::initialize()
+ */
+enum class ReadinessState : std::uint8_t
+{
+  UNINITIALIZED = 0, ///< initialize() has not completed
+  ARMED         = 1, ///< Crash handlers are installed; core_pattern and systemd-coredump setup is still running
+  READY         = 2  ///< Setup has finished
+};
+
+/**
+ * @enum DumpPriority
+ * @brief Order in which queued CoreDumpGenerator::generateDumpAsync() requests are served
+ */
+enum class DumpPriority : std::uint8_t
+{
+  LOW    = 0, ///< Housekeeping dumps; evicted first when the queue is full
+  NORMAL = 1,
+  HIGH   = 2 ///< Served before every LOW and NORMAL request
+};
+
+/**
+ * @struct DumpResult
+ * @brief Outcome of a dump requested with CoreDumpGenerator::generateDumpAsync()
+ */
+struct DumpResult {
+  bool m_success = false;
+  std::error_code m_error;             ///< Why the dump failed or was not run (empty on success)
+  std::vector<std::string> m_reasons; ///< Reasons of every request served by this dump, in arrival order
+  std::chrono::steady_clock::duration m_queueTime{}; ///< From the request until the worker picked it up
+  std::chrono::steady_clock::duration m_dumpTime{};  ///< Time spent writing the dump
+};
+
+/**
+ * @class CoreDumpGenerator
+ * @brief Cross-platform crash dump handler with comprehensive debugging support
+ *
+ * This class provides a robust, thread-safe crash dump handler that
+ * automatically captures memory dumps when crashes occur on both Windows and
+ * UNIX platforms. It supports multiple dump types through the DumpFactory
+ * pattern and provides comprehensive debugging information for post-mortem
+ * analysis.
+ *
+ * @details The CoreDumpGenerator offers:
+ * - Automatic crash detection and dump generation
+ * - Cross-platform compatibility (Windows/UNIX)
+ * - Multiple dump types and configurations
+ * - Thread-safe singleton pattern implementation
+ * - Comprehensive error handling and logging
+ * - Security-focused path validation
+ * - Atomic file operations to prevent race conditions
+ *
+ * @invariant The singleton instance is created only once and is thread-safe
+ * @invariant All file operations are atomic to prevent TOCTOU race conditions
+ * @invariant All input paths are validated for security vulnerabilities
+ * @invariant Platform-specific handlers are properly initialized
+ *
+ * @thread_safety This class is thread-safe. Multiple threads can call
+ * public methods concurrently without external synchronization.
+ *
+ * @exception_safety All public methods provide strong exception safety
+ * guarantee unless otherwise specified. Methods marked noexcept provide
+ * no-throw guarantee.
+ *
+ * @since Version 1.0
+ * @see DumpType
+ * @see DumpConfiguration
+ * @see DumpFactory
+ *
+ * @example
+ * ```cpp
+ * // Initialize the crash dump handler
+ * CoreDumpGenerator::initialize("/path/to/dumps",
+ * DumpType::MINI_DUMP_WITH_FULL_MEMORY);
+ *
+ * // Generate a manual dump
+ * CoreDumpGenerator::generateDump("Manual dump for testing");
+ *
+ * // Get the singleton instance
+ * auto& generator = CoreDumpGenerator::instance();
+ * ```
+ */
+class CoreDumpGenerator
+{
+public:
+  static constexpr size_t const KB_32                     = 32ULL * 1024ULL;   // 32KB
+  static constexpr size_t const KB_64                     = 64ULL * 1024ULL;   // 64KB
+  static constexpr size_t const KB_128                    = 128ULL * 1024ULL;  // 128KB
+  static constexpr size_t const KB_256                    = 256ULL * 1024ULL;  // 256KB
+  static constexpr size_t const KB_512                    = 512ULL * 1024ULL;  // 512KB
+  static constexpr size_t const MB_1                      = 1024ULL * 1024ULL; // 1MB
+
+  CoreDumpGenerator(CoreDumpGenerator const &)            = delete;
+  CoreDumpGenerator &operator=(CoreDumpGenerator const &) = delete;
+  CoreDumpGenerator(CoreDumpGenerator &&)                 = delete;
+  CoreDumpGenerator &operator=(CoreDumpGenerator &&)      = delete;
+  ~CoreDumpGenerator() noexcept
+  {
+#if DUMP_CREATOR_UNIX
+    // Stop instant systemd monitor thread
+    _stopSystemdMonitor();
+
+    // Restore original core pattern on destruction
+    _restoreCorePattern();
+#endif
+  }
+
+  /**
+   * @brief Initialize the crash dump handler
+   *
+   * Sets up platform-specific crash handlers with default configuration.
+   * Also sets up C++ exception handling.
+   *
+   * @param dumpDirectory Optional directory path for dump files.
+   *                      If empty, uses executable directory.
+   * @param dumpType Type of dump to generate (defaults to platform-specific)
+   * @param handleExceptions Whether to handle unhandled C++ exceptions
+   * (default: true)
+   * @throws std::runtime_error if initialization fails
+   * @throws std::system_error if filesystem operations fail
+   * @throws std::invalid_argument if configuration is invalid
+   *
+   * @complexity O(1) for basic initialization, O(n) where n is directory depth
+   * for recursive creation
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety Strong guarantee: if an exception is thrown, the object
+   * remains in a valid state
+   */
+  static void initialize(std::string const &dumpDirectory = "", DumpType dumpType = DumpType::DEFAULT_AUTO,
+                         bool handleExceptions = true);
+
+  /**
+   * @brief Initialize the crash dump handler with full configuration
+   *
+   * Sets up platform-specific crash handlers with custom configuration.
+   * Also sets up C++ exception handling.
+   *
+   * @param config Complete dump configuration
+   * @param handleExceptions Whether to handle unhandled C++ exceptions
+   * (default: true)
+   * @throws std::runtime_error if initialization fails
+   * @throws std::system_error if filesystem operations fail
+   */
+  static void initialize(DumpConfiguration const &config, bool handleExceptions = true);
+
+  /**
+   * @brief Check if the dump creator is initialized
+   *
+   * @return true if initialized, false otherwise
+   */
+  static bool isInitialized() noexcept;
+
+  /**
+   * @brief Get how far initialization has progressed
+   *
+   * initialize() returns once the crash handlers are armed (ARMED). With
+   * DumpConfiguration::setDeferredSetup(true), the default, core_pattern
+   * negotiation, systemd-coredump detection and the monitor start then
+   * finish on a background thread (READY). Crashes while ARMED are dumped
+   * by the signal handlers; only kernel-written cores may still follow the
+   * previous core_pattern.
+   *
+   * @return Current readiness state
+   *
+   * @complexity O(1)
+   * @thread_safety This function is thread-safe and lock-free
+   * @exception_safety No-throw guarantee
+   */
+  static ReadinessState getReadinessState() noexcept;
+
+  /**
+   * @brief Wait until the background part of initialize() has finished
+   *
+   * @return true once READY, false at once if initialize() has not completed
+   * @note Call it after initialize() has returned, e.g. on the thread that
+   * called it; a call racing initialize() may see UNINITIALIZED and return
+   * false without waiting
+   *
+   * @complexity O(1), blocks for as long as the setup takes (sudo never prompts)
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety Strong guarantee
+   */
+  static bool waitUntilReady();
+
+  /**
+   * @brief Wait at most timeout until the background part of initialize() has finished
+   *
+   * @param timeout Longest time to wait
+   * @return true if READY, false on timeout or if initialize() has not completed
+   * @note Like waitUntilReady(), only waits once initialize() has returned
+   *
+   * @complexity O(1)
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety Strong guarantee
+   */
+  static bool waitUntilReady(std::chrono::milliseconds timeout);
+
+  /**
+   * @brief Manually trigger a dump generation
+   *
+   * The dump is written on the calling thread. If an equally configured dump
+   * is already queued or being written, the call waits for that dump and
+   * returns its outcome instead (see generateDumpAsync()).
+   *
+   * @param reason Optional reason for the dump generation
+   * @param dumpType Type of dump to generate (uses current config if
+   * DEFAULT_AUTO)
+   * @return true if dump was generated successfully, false otherwise
+   * @throws std::runtime_error if not initialized
+   * @throws std::system_error if filesystem operations fail
+   * @throws std::invalid_argument if dump type is not supported
+   *
+   * @complexity O(1) for basic operations, O(n) where n is memory size for full
+   * dumps
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety Basic guarantee: if an exception is thrown, the system
    * remains in a valid state
    */
   static bool generateDump(std::string const &reason = "Manual dump", DumpType dumpType = DumpType::DEFAULT_AUTO);
@@ -1119,6 +5614,49 @@ public:
    */
   static bool generateDump(DumpConfiguration const &config, std::string const &reason = "Manual dump");
 
+  /**
+   * @brief Queue a dump and return without waiting for it
+   *
+   * The request goes to a bounded priority queue that a dedicated worker
+   * thread serves one dump at a time, so the caller only pays for copying
+   * the configuration and the enqueue. The worker is started by the first
+   * request. When MAX_PENDING_DUMPS requests are already waiting, the
+   * lowest-priority, newest of them is dropped in favor of a request with
+   * a higher priority; otherwise the new request is refused. Dropped and
+   * refused requests complete with std::errc::resource_unavailable_try_again.
+   * Requests still queued when the library shuts down complete with
+   * std::errc::operation_canceled.
+   *
+   * Concurrent requests are coalesced: a request whose configuration equals
+   * that of a dump that is queued or being written, by this function or by
+   * generateDump(), adds its reason to that dump and gets the same result
+   * instead of writing another one. A queued dump takes the highest
+   * priority of its requests. With DumpConfiguration::setCoalescingWindow()
+   * requests also reuse a dump that finished less than the window ago.
+   *
+   * @param reason Reason for the dump generation
+   * @param priority Position in the queue relative to other pending requests
+   * @return Result shared by every request the dump serves; becomes ready once
+   * the dump is written or the request rejected
+   * @throws std::runtime_error if not initialized
+   * @note On UNIX the worker thread is the current thread of the dump; the
+   * requesting thread is captured with the other threads of the process
+   *
+   * @complexity O(log n) - n = pending requests (at most MAX_PENDING_DUMPS)
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety Strong guarantee
+   */
+  static std::shared_future<DumpResult> generateDumpAsync(std::string const &reason = "Manual dump",
+                                                          DumpPriority priority      = DumpPriority::NORMAL);
+
+  /**
+   * @brief Queue a dump with a custom configuration and return without waiting for it
+   * @see generateDumpAsync(std::string const &, DumpPriority)
+   */
+  static std::shared_future<DumpResult> generateDumpAsync(DumpConfiguration const &config,
+                                                          std::string const &reason = "Manual dump",
+                                                          DumpPriority priority     = DumpPriority::NORMAL);
+
   /**
    * @brief Get the singleton instance
    *
@@ -1148,6 +5686,7 @@ public:
    * @param dumpType New dump type to use
    * @return true if successfully set, false if not supported
    * @throws std::runtime_error if not initialized
+   * @note Never waits for dumps; those already running keep the configuration they started with
    */
   static bool setDumpType(DumpType dumpType);
 
@@ -1214,6 +5753,145 @@ public:
    */
   static bool registerCustomSignalHandler(int signum, void (*handler)(int)) noexcept;
 
+  /**
+   * @brief Prepare the calling thread for stack-overflow crash dumps
+   *
+   * On UNIX the crash handlers run on an alternate signal stack, so a thread
+   * that exhausts its own stack can still be dumped. initialize() registers
+   * the thread it is called from; every other thread should call this once
+   * at startup. The stack is leased from a pool preallocated by initialize()
+   * and returned automatically when the thread exits. A thread that already
+   * has an alternate stack keeps it. On Windows the thread's stack guarantee
+   * is raised so the exception filter has room to run.
+   *
+   * @return true if the thread can handle a stack overflow, false otherwise
+   * @note Calling it again on a registered thread is a no-op
+   *
+   * @complexity O(1) - constant time operation
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety No-throw guarantee
+   */
+  static bool registerThread() noexcept;
+
+  /**
+   * @brief Return the calling thread's alternate signal stack to the pool early
+   * @note Only needed for long-lived threads that stop using the library;
+   * exiting threads release their stack automatically
+   */
+  static void unregisterThread() noexcept;
+
+  /**
+   * @brief Leave a memory range out of every future dump
+   *
+   * For caches and other bulk state that is worthless post mortem. On UNIX
+   * the range is marked MADV_DONTDUMP, so kernel cores skip it too, and is
+   * recorded in a lock-free registry that manual, snapshot and crash dumps
+   * consult; their cores keep the program header but not the contents, and
+   * list the range with its label in a CDGEN note. Only whole pages inside
+   * the range are excluded. Safe to call from allocator hooks: it takes no
+   * locks and does not allocate. Not available on Windows.
+   *
+   * The registry records addresses, not mappings. Call includeRegion()
+   * before the range is unmapped: munmap() drops MADV_DONTDUMP but not the
+   * registry entry, which keeps its slot and excludes whatever is mapped
+   * at that address later.
+   *
+   * @param address Start of the range
+   * @param size Length in bytes
+   * @param label Short description stored in the dump (truncated to 31 bytes), may be nullptr
+   * @return true if the range was recorded, false if it holds no whole page
+   * or all 1024 registry slots are in use
+   *
+   * @complexity O(1) amortized - one madvise() and a slot claim
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety No-throw guarantee
+   */
+  static bool excludeRegion(void const *address, size_t size, char const *label = nullptr) noexcept;
+
+  /**
+   * @brief Dump a range excluded with excludeRegion() again
+   *
+   * Clears MADV_DONTDUMP on the whole pages of the range and removes it
+   * from the registry; excluded ranges that only overlap it are trimmed.
+   * Must be called before the range is unmapped (see excludeRegion()).
+   *
+   * @param address Start of the range
+   * @param size Length in bytes
+   * @return false if the range holds no whole page or a trimmed range could
+   * not be split (registry full)
+   *
+   * @complexity O(n) - n = registry slots in use
+   * @thread_safety This function is thread-safe and may be called concurrently
+   * @exception_safety No-throw guarantee
+   */
+  static bool includeRegion(void const *address, size_t size) noexcept;
+
+  /**
+   * @brief Enter crash helper mode if this process was spawned as one
+   *
+   * With DumpConfiguration::setCrashHelper(true), initialize() spawns a
+   * helper process (by default this same executable) that stays connected
+   * over a socketpair. On a crash the signal handler only sends the
+   * crashing thread's registers and signal information and waits; the
+   * helper stops the remaining threads with ptrace, reads the memory with
+   * process_vm_readv() and writes the core (compressed if configured). If
+   * the helper is unavailable or stops writing for CRASH_HELPER_STALL_SECONDS,
+   * the dump is written in-process as before. A helper that died is reaped
+   * and restarted by the next generateDump() or generateDumpAsync() call.
+   *
+   * Call this first thing in main(), before any other work:
+   * @code
+   * int main(int argc, char **argv)
+   * {
+   *   CoreDumpGenerator::runCrashHelper(argc, argv);
+   *   ...
+   * }
+   * @endcode
+   *
+   * @param argc Argument count passed to main()
+   * @param argv Argument vector passed to main()
+   * @return false if the process is not a crash helper; a helper never
+   * returns and exits once the process it serves is gone
+   *
+   * @complexity O(1) for ordinary processes
+   * @thread_safety Must be called before other threads are started
+   * @exception_safety No-throw guarantee
+   */
+  static bool runCrashHelper(int argc, char **argv) noexcept;
+
+  /**
+   * @brief Store a kernel core piped to this process through core_pattern
+   *
+   * With DumpConfiguration::setCorePatternHelperPath(), initialize() sets
+   * core_pattern to "|<helper> <directory> <compression> %t %p %s %u %g %e"
+   * instead of a file path. The kernel then streams each core to the
+   * helper's stdin, and this function stores it as
+   * <directory>/core_dump_full_<time>_<pid>_<exe>.core[.zst|.lz4]:
+   * compressed in parallel if configured, otherwise with zero pages left as
+   * file holes, owned by the crashed process's user. A <same stem>.json file
+   * records the process, signal, sizes and throughput. Started as root, the
+   * helper switches to the crashed process's uid and gid before it opens the
+   * directory, and it only creates new files there, never following a
+   * symbolic link.
+   *
+   * The CoreDumpGeneratorPipeHelper target is a ready-made helper:
+   * @code
+   * int main(int argc, char **argv)
+   * {
+   *   return CoreDumpGenerator::runCorePatternHelper(argc, argv) ? EXIT_SUCCESS : EXIT_FAILURE;
+   * }
+   * @endcode
+   *
+   * @param argc Argument count passed to main()
+   * @param argv Argument vector passed to main()
+   * @return true if the core was stored completely
+   *
+   * @complexity O(n) - n = core size
+   * @thread_safety Meant to be the only work of its process
+   * @exception_safety No-throw guarantee
+   */
+  static bool runCorePatternHelper(int argc, char **argv) noexcept;
+
 #if DUMP_CREATOR_WINDOWS
   /**
    * @brief Register a custom console handler for Windows graceful shutdown
@@ -1305,13 +5983,14 @@ public:
 #if HAS_RANGES
   /**
    * @brief Get all memory filters as a range
-   * @return Range of memory filters
+   * @return Range owning a copy of the current memory filters
    * @note This method is thread-safe
    */
   static auto
   getMemoryFiltersRange() noexcept
   {
-    return s_currentConfig.getMemoryFilters() | std::views::all;
+    std::vector<std::string> filters = getCurrentConfiguration().getMemoryFilters();
+    return std::move(filters) | std::views::all; // Owns its copy: setDumpType() may replace the configuration
   }
 #endif
 
@@ -1365,14 +6044,28 @@ private:
 #else
   static bool s_initialized;
 #endif
-  static DumpConfiguration s_currentConfig;
+  struct ConfigSnapshot;
+  class ConfigStore;
+  static ConfigStore s_configStore; // Active configuration
   static std::string s_originalCorePattern;
 
 #if DUMP_CREATOR_UNIX
   // Instant systemd-coredump monitor thread (for IMMEDIATE extraction)
   static std::atomic_bool s_monitorThreadShouldStop;
   static std::thread s_monitorThread;
+  static int s_monitorWakeFd; // eventfd that wakes the monitor for shutdown
   static pid_t s_applicationPid; // Store PID for filtering core dumps
+  // Crash path state, prepared by initialize() so that a crash needs no allocation
+  static char s_crashPath[PATH_MAX];       // "<dir>/crash_" prefix, completed in place when crashing
+  static size_t s_crashPrefixLength;       // 0 until the prefix is prepared
+  static char s_crashToken[33];            // Random filename component
+  static std::atomic<pid_t> s_crashThread; // Thread writing the crash dump (0 = none)
+  static CoreDumpEngine::CrashRecord s_crashRecord; // Filled by the crashing thread
+  static int s_helperSocket;             // Connection to the crash helper (-1 = none)
+  static std::atomic<pid_t> s_helperPid; // Crash helper process (0 = none or reaped)
+  static pid_t s_helperClient;           // Process that spawned the helper; forked children do not use it
+  static unsigned s_helperRestarts;      // Helpers started again after the first one died
+  static std::mutex s_helperMutex;       // Serializes liveness checks and restarts
 #endif
 
   // Custom signal handlers for graceful shutdown
@@ -1418,13 +6111,24 @@ private:
 
   // Concurrency control
   static constexpr size_t MAX_CONCURRENT_OPERATIONS = 4;
+  static constexpr size_t MAX_PENDING_DUMPS          = 16; ///< Capacity of the generateDumpAsync() queue
+  static constexpr int SNAPSHOT_NICE_INCREMENT       = 10; ///< Priority drop of the snapshot writer process
   static std::atomic<size_t> s_activeOperations;
   static std::condition_variable s_operationCondition;
   static std::mutex s_operationMutex;
+  class DumpScheduler;
+  static DumpScheduler s_scheduler;
+  class DeferredSetup;
+  static DeferredSetup s_setup; // Background part of initialize()
 
   // Platform-specific initialization
   static void _platformInitialize();
 
+  /**
+   * @brief Slow part of initialization: core_pattern, systemd-coredump detection, monitor start
+   */
+  static void _completePlatformInitialize() noexcept;
+
   // Exception handling
   static void _setupExceptionHandling();
   static void _unhandledExceptionHandler();
@@ -1465,6 +6169,84 @@ private:
    */
   static void _unixSignalHandler(int signum) noexcept;
 
+  /**
+   * @brief SA_SIGINFO crash handler
+   * @details Writes the crash dump from the interrupted context, then re-raises
+   * the signal with its default action
+   */
+  static void _unixCrashHandler(int signum, siginfo_t *info, void *context) noexcept;
+
+  /**
+   * @brief Reserve the crash arena and preformat the crash dump path
+   * @details Everything the crash path needs is set up here, at initialize() time
+   */
+  static void _prepareCrashPath() noexcept;
+
+  /**
+   * @brief Write a crash dump without malloc or locks
+   * @details Filename, memory map, register state and writer buffers all come
+   * from the preallocated crash arena, so this works after heap corruption or
+   * a crash inside the allocator. The output is an uncompressed core named
+   * <dir>/crash_<signal>_<time>_<pid>_<tid>_<token>.core.
+   * A CrashRecord (signal, si_code, fault address, sender, registers,
+   * faulting module) is written first to a .crashinfo sidecar and then as a
+   * note into the core.
+   * @param signum Signal recorded in NT_PRSTATUS
+   * @param info Signal information (SA_SIGINFO), nullptr if unavailable
+   * @param context Interrupted context (SA_SIGINFO), nullptr to capture the caller
+   * @return true if the core was written completely
+   * @note Async-signal-safe. Only the first crashing thread writes; others
+   * block until it terminates the process
+   */
+  static bool _writeCrashDump(int signum, siginfo_t const *info, ucontext_t const *context) noexcept;
+
+  /**
+   * @brief Write the core and .crashinfo sidecar of a crashed process
+   * @details Shared by the in-process crash path and the crash helper. Uses
+   * the crash path prefix, token and memory filter prepared in static storage;
+   * the path of the written core is left in s_crashPath.
+   * @param target Process to dump and output settings
+   * @param threads Crashing thread first, with its signal set
+   * @param stackPointers Stack pointers of threads without registers
+   * @return true if the core was written completely
+   * @note Async-signal-safe when the caller holds the crash arena and
+   * target.m_compress is false
+   */
+  static bool _writeCrashCore(CoreDumpEngine::CrashTarget const &target, int signum, siginfo_t const *info,
+                              CoreDumpEngine::ThreadList &threads, CoreDumpEngine::AddressList &stackPointers) noexcept;
+
+  /**
+   * @brief Describe the calling process and the current configuration as a crash target
+   */
+  static CoreDumpEngine::CrashTarget _describeCrashTarget() noexcept;
+
+  /**
+   * @brief Spawn the crash helper and send it the crash target (initialize() time)
+   */
+  static void _startCrashHelper() noexcept;
+
+  /**
+   * @brief Reap a crash helper that died and start a new one, a bounded number of times
+   * @details Called from the dump entry points, never from the crash path. Until a
+   * new helper runs, crashes are written in-process.
+   */
+  static void _checkCrashHelper() noexcept;
+
+  /**
+   * @brief Crash helper main loop: one dump per request until the socket closes
+   * @param fd Helper end of the socketpair
+   * @return true if the served process went away normally
+   */
+  static bool _serveCrashHelper(int fd) noexcept;
+
+  /**
+   * @brief Hand the crash to the helper and wait for the dump
+   * @param thread Registers of the crashing thread
+   * @return true if the helper wrote the core; its path is copied to s_crashPath
+   * @note Async-signal-safe
+   */
+  static bool _requestHelperDump(int signum, siginfo_t const *info, CoreDumpEngine::ThreadState const &thread) noexcept;
+
   /**
    * @brief Wrapper for custom signal handlers
    * @details Calls custom handler if registered, otherwise calls default crash handler
@@ -1476,11 +6258,21 @@ private:
    */
   static void _generateCoreDump();
 
+  /**
+   * @brief Write core_pattern through "sudo -n tee", started with posix_spawnp() instead of a shell
+   * @details The pattern reaches tee through a pipe, so it needs no quoting. Unlike system(), this leaves the
+   *          SIGINT and SIGQUIT dispositions of the process alone while sudo runs
+   * @return true if sudo exited successfully
+   */
+  static bool _writeCorePatternWithSudo(std::string const &pattern) noexcept;
+
   /**
    * @brief Log core dump file size (UNIX helper)
    * @param filename The path to the core dump file
+   * @param coreBytes Uncompressed core size; when it differs from the file size
+   *        the compression ratio is logged as well (0 = unknown)
    */
-  static void _logCoreDumpSize(std::string const &filename) noexcept;
+  static void _logCoreDumpSize(std::string const &filename, std::uint64_t coreBytes = 0) noexcept;
 
   /**
    * @brief Setup signal handlers
@@ -1496,15 +6288,62 @@ private:
    */
   static void _setupCoreDumpSettings();
 
+  /**
+   * @brief Write and verify /proc/self/coredump_filter if the active configuration sets a filter
+   */
+  static void _setupCoreDumpFilter();
+
+  /**
+   * @brief Read or write /proc/self/coredump_filter
+   */
+  static bool _readCoreDumpFilter(std::uint32_t &filter) noexcept;
+  static bool _writeCoreDumpFilter(std::uint32_t filter) noexcept;
+
   /**
    * @brief Setup core pattern for custom dump location
    */
-  static void _setupCorePattern();
+  static void _setupCorePattern();
+
+  /**
+   * @brief Create UNIX dump with specific type
+   * @param filename Destination path of the dump
+   * @param config Dump configuration selecting the capture engine
+   * @return true if the dump file was written completely
+   */
+  static bool _createUnixDump(std::string const &filename, DumpConfiguration const &config);
+
+  /**
+   * @brief Write an ELF core of the running process with the native writer
+   * @details Walks /proc/self/maps and streams PT_LOAD segments plus
+   *          NT_PRSTATUS/NT_PRPSINFO/NT_AUXV/NT_FILE notes without gcore/gdb
+   * @param filename Destination path (must not exist)
+   * @param config Dump configuration
+   * @return true on success, false otherwise
+   */
+  static bool _createManualCoreDump(std::string const &filename, DumpConfiguration const &config) noexcept;
+
+  /**
+   * @brief Write an ELF core from a forked copy-on-write snapshot
+   * @details The caller only pauses for fork(); the child writes the core from
+   *          its COW image at reduced priority and a detached reaper thread
+   *          logs the result and the performance metrics once it exits
+   * @param filename Destination path (written as <filename>.partial, then renamed)
+   * @param config Dump configuration
+   * @return true if the snapshot process was started, false otherwise
+   */
+  static bool _createSnapshotCoreDump(std::string const &filename, DumpConfiguration const &config) noexcept;
 
   /**
-   * @brief Create core dump manually using external tools
+   * @brief Compiled memory filter for a dump configuration
+   * @details Reuses the matcher compiled with the active configuration when the
+   *          filters are unchanged, so regular dumps never re-parse filter strings
+   * @param config Dump configuration
+   * @param active Active configuration snapshot, held by the caller for the dump
+   * @param scratch Storage for a matcher compiled on demand
+   * @return Matcher to apply while enumerating /proc/self/maps
    */
-  static void _createManualCoreDump();
+  static MemoryFilter const &_resolveMemoryFilter(DumpConfiguration const &config, ConfigSnapshot const &active,
+                                                  MemoryFilter &scratch) noexcept;
 
   /**
    * @brief Restore original core pattern
@@ -1517,12 +6356,32 @@ private:
 
   /**
    * @brief INSTANT systemd-coredump monitor using inotify (runs in background thread)
-   * @details Monitors /var/lib/systemd/coredump/ using Linux inotify API
-   *          Immediately extracts new core dumps to dumps/ directory
+   * @details Blocks in epoll_wait() on an inotify watch of DumpConfiguration::getSystemdCoredumpDirectory()
+   *          (/var/lib/systemd/coredump/ by default) and on s_monitorWakeFd, so
+   *          it never wakes up while idle. A file is picked up on the first IN_CREATE (an O_TMPFILE linked
+   *          into place), IN_CLOSE_WRITE or IN_MOVED_TO that carries its final name, i.e. once systemd-coredump
+   *          has finished it, and handed to up to SYSTEMD_EXTRACTION_WORKERS worker threads that are started
+   *          on demand. Later events for the same name are ignored.
    * @note Requires user in systemd-journal group
-   * @source Official Linux inotify(7) man page
+   * @source Official Linux inotify(7) and epoll(7) man pages
    */
   static void _instantSystemdMonitor() noexcept;
+
+  /**
+   * @brief Extract one systemd-coredump file into s_dumpDirectory (runs on a monitor worker)
+   * @details Reads the file directly (CoreDumpEngine::extractSystemdCore()) and falls back to coredumpctl if it
+   *          cannot be opened, e.g. for lack of read access
+   * @param directory Watched systemd-coredump directory
+   * @param fileName Name of the file in directory
+   * @param decompress DumpConfiguration::isDecompressSystemdCores()
+   */
+  static void _extractSystemdCoreDump(std::string const &directory, std::string const &fileName,
+                                      bool decompress) noexcept;
+
+  /**
+   * @brief Stop the systemd-coredump monitor thread and release its eventfd
+   */
+  static void _stopSystemdMonitor() noexcept;
 #endif
 
   // Utility functions
@@ -1594,8 +6453,10 @@ private:
   struct PerformanceMetrics {
     std::chrono::high_resolution_clock::time_point m_startTime;
     std::chrono::high_resolution_clock::time_point m_endTime;
+    std::chrono::nanoseconds m_forkPause{0}; ///< Time the caller was stopped in fork() (snapshot mode)
     size_t m_dumpSize = 0;
     bool m_success    = false;
+    bool m_snapshot   = false;
   };
 
   static void _startPerformanceMonitoring(PerformanceMetrics &metrics) noexcept;
@@ -1616,6 +6477,7 @@ private:
   {
   public:
     OperationGuard() noexcept;
+    explicit OperationGuard(std::try_to_lock_t) noexcept; ///< Non-blocking: check isAcquired()
     ~OperationGuard() noexcept;
     OperationGuard(OperationGuard const &)            = delete;
     OperationGuard &operator=(OperationGuard const &) = delete;
@@ -1632,6 +6494,226 @@ private:
     bool m_acquired = false;
   };
 
+  using OperationGuards = std::vector<std::unique_ptr<OperationGuard>>;
+
+  /**
+   * @class DumpScheduler
+   * @brief Bounded priority queue of generateDumpAsync() requests, served by one worker thread
+   * @details Every request is served by a Capture. A request whose configuration equals that of a capture that
+   *          is queued or being written, or that finished within its DumpConfiguration::getCoalescingWindow(),
+   *          attaches its reason to that capture and shares its result instead of writing another dump.
+   *          generateDump() writes on the calling thread but registers its capture the same way; an equal
+   *          capture that is still queued is taken out of the queue and written by that thread.
+   *          Dumps take the same path either way, including its OperationGuard slots, so queued and
+   *          synchronous dumps share MAX_CONCURRENT_OPERATIONS and wait on s_operationCondition.
+   *          Requests of equal priority are served in arrival order.
+   */
+  class DumpScheduler
+  {
+  public:
+    DumpScheduler() = default;
+    ~DumpScheduler() noexcept;
+    DumpScheduler(DumpScheduler const &)            = delete;
+    DumpScheduler &operator=(DumpScheduler const &) = delete;
+
+    /**
+     * @brief Queue a dump or attach to an equivalent one; starts the worker on first use
+     * @return Result shared by every request of the capture, already satisfied if it was refused
+     */
+    std::shared_future<DumpResult> submit(DumpConfiguration const &config, std::string const &reason,
+                                          DumpPriority priority);
+
+    /**
+     * @brief Write a dump on the calling thread, taking over an equivalent queued capture
+     * @details Only waits for an equivalent capture that is already being written, so a synchronous caller
+     *          never sits behind the queue or loses its request to an eviction
+     */
+    DumpResult run(DumpConfiguration const &config, std::string const &reason);
+
+  private:
+    /**
+     * @brief One dump and every request coalesced into it
+     */
+    struct Capture {
+      explicit Capture(DumpConfiguration const &config) : m_config(config), m_future(m_promise.get_future()) {}
+
+      DumpConfiguration m_config;
+      std::vector<std::string> m_reasons; ///< Grows under m_mutex until the capture finishes
+      DumpPriority m_priority  = DumpPriority::NORMAL;
+      std::uint64_t m_sequence = 0;
+      std::chrono::steady_clock::time_point m_queued = std::chrono::steady_clock::now();
+      std::chrono::steady_clock::time_point m_finished;
+      std::promise<DumpResult> m_promise;
+      std::shared_future<DumpResult> m_future;
+    };
+    using CapturePointer = std::shared_ptr<Capture>;
+
+    /**
+     * @brief Heap order: true if lhs is served after rhs
+     */
+    static bool _servedLater(CapturePointer const &lhs, CapturePointer const &rhs) noexcept;
+    static void _complete(Capture &capture, std::errc error) noexcept;
+
+    /**
+     * @brief Capture the request can join, with its reason already attached (call with m_mutex held)
+     */
+    CapturePointer _attach(DumpConfiguration const &config, std::string const &reason, DumpPriority priority);
+
+    /**
+     * @brief Write the dump of a capture in m_running and deliver the result to all of its requests
+     */
+    DumpResult _execute(CapturePointer const &capture) noexcept;
+    void _workerLoop() noexcept;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<CapturePointer> m_pending;  ///< Heap ordered by _servedLater()
+    std::vector<CapturePointer> m_running;  ///< Being written by the worker or a generateDump() caller
+    std::vector<CapturePointer> m_finished; ///< Still inside their coalescing window
+    std::uint64_t m_nextSequence = 0;
+    bool m_stopping              = false;
+    std::thread m_worker;
+  };
+
+  /**
+   * @brief Active configuration, never modified once published; setDumpType() publishes a new one
+   */
+  struct ConfigSnapshot {
+    DumpConfiguration m_config;
+#if DUMP_CREATOR_UNIX
+    MemoryFilter m_memoryFilter; ///< m_config memory filters, compiled once per snapshot
+#endif
+  };
+
+  /**
+   * @class ConfigStore
+   * @brief Publishes the active ConfigSnapshot by pointer swap and frees replaced ones by epoch (RCU)
+   * @details A Reader costs two atomic increments and never waits or allocates, so dumps, getters and signal
+   *          handlers read the configuration while setDumpType() replaces it. A reader counts itself in the slot
+   *          of the epoch it started in. publish() swaps the pointer, then moves the epoch on only while the
+   *          slot of the previous epoch is empty; a replaced snapshot is freed two epochs after the swap, when
+   *          no reader can still hold it. publish() never waits for readers, but while one Reader is held the
+   *          epoch moves on at most once more: every snapshot replaced in the meantime stays allocated until the
+   *          Reader is gone and a later publish() reclaims it. Readers are therefore kept for short reads only;
+   *          generateDump() copies the configuration out before the dump runs, the manual dump releases its
+   *          Reader once the memory map is loaded, the snapshot dump once the child is forked, and only the
+   *          crash path (which does not return) holds one while it writes.
+   */
+  class ConfigStore
+  {
+  public:
+    /**
+     * @brief Wait-free, async-signal-safe access to the active snapshot for the lifetime of the guard
+     */
+    class Reader
+    {
+    public:
+      explicit Reader(ConfigStore &store) noexcept;
+      ~Reader() noexcept;
+      Reader(Reader const &)            = delete;
+      Reader &operator=(Reader const &) = delete;
+
+      ConfigSnapshot const &
+      operator*() const noexcept
+      {
+        return *m_snapshot;
+      }
+      ConfigSnapshot const *
+      operator->() const noexcept
+      {
+        return m_snapshot;
+      }
+
+    private:
+      std::atomic<std::uint32_t> &m_slot;
+      ConfigSnapshot const *m_snapshot = nullptr;
+    };
+
+    ConfigStore() : m_active(new ConfigSnapshot()) {}
+    ~ConfigStore() noexcept;
+    ConfigStore(ConfigStore const &)            = delete;
+    ConfigStore &operator=(ConfigStore const &) = delete;
+
+    /**
+     * @brief Make a copy of config the active configuration; readers keep the snapshot they hold
+     * @return False if the memory filters did not compile (the snapshot then captures all regions)
+     * @throws std::bad_alloc before anything is published
+     */
+    bool publish(DumpConfiguration const &config);
+
+  private:
+    using Retired = std::pair<std::uint32_t, std::unique_ptr<ConfigSnapshot const>>; ///< Epoch of the swap
+
+    /**
+     * @brief Move the epoch on as far as readers allow and free what no reader can hold (m_writerMutex held)
+     */
+    void _reclaim() noexcept;
+
+    std::atomic<ConfigSnapshot const *> m_active;
+    std::atomic<std::uint32_t> m_epoch{0};
+    std::atomic<std::uint32_t> m_readers[2] = {}; ///< Readers by parity of the epoch they started in
+    std::mutex m_writerMutex;
+    std::vector<Retired> m_retired;
+  };
+
+  /**
+   * @class DeferredSetup
+   * @brief Runs _completePlatformInitialize() once initialize() has armed the crash handlers
+   * @details The setup may wait on sudo, so by default it runs on its own thread, which is joined at exit
+   *          before the state it uses is destroyed.
+   */
+  class DeferredSetup
+  {
+  public:
+    DeferredSetup() = default;
+    ~DeferredSetup() noexcept;
+    DeferredSetup(DeferredSetup const &)            = delete;
+    DeferredSetup &operator=(DeferredSetup const &) = delete;
+
+    /**
+     * @brief Enter ARMED and finish the setup on a new thread, or on this one if deferred is false
+     */
+    void start(bool deferred) noexcept;
+
+    ReadinessState
+    getState() const noexcept
+    {
+      return m_state.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Wait while ARMED; true if READY
+     */
+    bool wait();
+    bool waitFor(std::chrono::milliseconds timeout);
+
+  private:
+    void _finish() noexcept;
+    bool _isSettled() const noexcept;
+
+    std::atomic<ReadinessState> m_state{ReadinessState::UNINITIALIZED};
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::thread m_thread;
+  };
+
+  /**
+   * @brief Write one dump for the synchronous and the queued entry points
+   */
+  static DumpResult _runDump(DumpConfiguration const &config, std::string const &reason) noexcept;
+
+  /**
+   * @brief Reserve operation slots for a dump and its compression workers
+   * @details Blocks for the dump's own slot, then takes up to
+   *          min(hardware threads, MAX_CONCURRENT_OPERATIONS) - 1 further slots
+   *          without waiting; each extra slot becomes a compression worker. With
+   *          none free, one worker still runs so reading overlaps compression
+   * @param guards Receives the held slots; release them when the dump is done
+   * @param compress Whether the dump is compressed (uncompressed dumps take one slot)
+   * @return Number of compression worker threads to start (0 = compress inline)
+   */
+  static size_t _reserveOperationSlots(OperationGuards &guards, bool compress);
+
 // Windows privilege checking
 #if DUMP_CREATOR_WINDOWS
   static bool _isAdminPrivileges() noexcept;
@@ -1662,7 +6744,7 @@ std::atomic_bool CoreDumpGenerator::s_initialized{};
 bool CoreDumpGenerator::s_initialized = false;
 #endif
 std::string CoreDumpGenerator::s_originalCorePattern;
-DumpConfiguration CoreDumpGenerator::s_currentConfig;
+CoreDumpGenerator::ConfigStore CoreDumpGenerator::s_configStore;
 
 // Custom signal handlers initialization
 std::map<int, void (*)(int)> CoreDumpGenerator::s_customSignalHandlers;
@@ -1672,11 +6754,25 @@ std::mutex CoreDumpGenerator::s_customHandlersMutex;
 // Instant systemd monitor thread (for IMMEDIATE core dump extraction)
 std::atomic_bool CoreDumpGenerator::s_monitorThreadShouldStop{false};
 std::thread CoreDumpGenerator::s_monitorThread;
+int CoreDumpGenerator::s_monitorWakeFd = -1;
 pid_t CoreDumpGenerator::s_applicationPid = getpid(); // Store PID at initialization
+char CoreDumpGenerator::s_crashPath[PATH_MAX] = {};
+size_t CoreDumpGenerator::s_crashPrefixLength = 0;
+char CoreDumpGenerator::s_crashToken[33]      = {};
+std::atomic<pid_t> CoreDumpGenerator::s_crashThread{0};
+CoreDumpEngine::CrashRecord CoreDumpGenerator::s_crashRecord;
+int CoreDumpGenerator::s_helperSocket = -1;
+std::atomic<pid_t> CoreDumpGenerator::s_helperPid{0};
+pid_t CoreDumpGenerator::s_helperClient      = 0;
+unsigned CoreDumpGenerator::s_helperRestarts = 0;
+std::mutex CoreDumpGenerator::s_helperMutex;
 #endif
 #if DUMP_CREATOR_WINDOWS
 BOOL(WINAPI *CoreDumpGenerator::s_customConsoleHandler)(DWORD) = nullptr;
 #endif
+// Defined after the state they use, so they are destroyed (and their threads joined) first
+CoreDumpGenerator::DumpScheduler CoreDumpGenerator::s_scheduler;
+CoreDumpGenerator::DeferredSetup CoreDumpGenerator::s_setup;
 #if DUMP_CREATOR_UNIX
 void (*CoreDumpGenerator::s_unixConsoleHandler)() = nullptr;
 std::atomic_bool CoreDumpGenerator::s_posixSigThreadStarted{};
@@ -1761,6 +6857,10 @@ std::map<DumpType, std::string> const DumpFactory::s_descriptions = {
 
   // UNIX core dump types
   {DumpType::CORE_DUMP_FULL, "Full core dump with all memory"},
+  {DumpType::CORE_DUMP_STACK_ONLY, "Stack-only core dump - registers and live thread stacks"},
+  {DumpType::CORE_DUMP_STACKS_AND_DATA, "Core dump with thread stacks and module data segments"},
+  {DumpType::CORE_DUMP_HEAP_FILTERED, "Core dump of private writable memory (no code or shared mappings)"},
+  {DumpType::CORE_DUMP_COMPRESSED, "Compressed full core dump (zstd/lz4)"},
 
   // Default types
   {DumpType::DEFAULT_WINDOWS, "Default Windows dump type"},
@@ -1799,6 +6899,10 @@ std::map<DumpType, bool> const DumpFactory::s_platformSupport = {
 
   // UNIX core dump types
   {DumpType::CORE_DUMP_FULL, !DUMP_CREATOR_WINDOWS},
+  {DumpType::CORE_DUMP_STACK_ONLY, !DUMP_CREATOR_WINDOWS},
+  {DumpType::CORE_DUMP_STACKS_AND_DATA, !DUMP_CREATOR_WINDOWS},
+  {DumpType::CORE_DUMP_HEAP_FILTERED, !DUMP_CREATOR_WINDOWS},
+  {DumpType::CORE_DUMP_COMPRESSED, !DUMP_CREATOR_WINDOWS},
 
   // Default types
   {DumpType::DEFAULT_WINDOWS, DUMP_CREATOR_WINDOWS},
@@ -1836,7 +6940,11 @@ std::map<DumpType, size_t> const DumpFactory::s_estimatedSizes = {
   {DumpType::KERNEL_ACTIVE_DUMP, 0},                       // Variable - similar to full but smaller
 
   // UNIX core dump types
-  {DumpType::CORE_DUMP_FULL, 0}, // Variable - full process memory
+  {DumpType::CORE_DUMP_FULL, 0},                                  // Variable - full process memory
+  {DumpType::CORE_DUMP_STACK_ONLY, CoreDumpGenerator::KB_256},     // 256KB - headers, notes, live stacks
+  {DumpType::CORE_DUMP_STACKS_AND_DATA, CoreDumpGenerator::MB_1},  // 1MB - plus .data/.bss of modules
+  {DumpType::CORE_DUMP_HEAP_FILTERED, 0},                         // Variable - private writable memory
+  {DumpType::CORE_DUMP_COMPRESSED, 0},                            // Variable - full memory / compression ratio
 
   // Default types
   {DumpType::DEFAULT_WINDOWS, 0}, // Variable
@@ -1911,6 +7019,10 @@ namespace
 
     // UNIX core dump types
     case DumpType::CORE_DUMP_FULL:                              return "core_dump_full";
+    case DumpType::CORE_DUMP_STACK_ONLY:                        return "core_dump_stack_only";
+    case DumpType::CORE_DUMP_STACKS_AND_DATA:                   return "core_dump_stacks_and_data";
+    case DumpType::CORE_DUMP_HEAP_FILTERED:                     return "core_dump_heap_filtered";
+    case DumpType::CORE_DUMP_COMPRESSED:                        return "core_dump_compressed";
 
     // Default types
     case DumpType::DEFAULT_AUTO:                                return "default_auto";
@@ -1951,7 +7063,8 @@ CoreDumpGenerator::initialize(DumpConfiguration const &config, bool handleExcept
   try
   {
     // Set configuration
-    s_currentConfig = config;
+    if(!s_configStore.publish(config))
+      _logMessage("WARNING: Invalid memory filter ignored, capturing all regions", true);
 
     // Set dump directory
     s_dumpDirectory = config.getDirectory().empty() ? _getExecutableDirectory() + "/dumps" : config.getDirectory();
@@ -1970,136 +7083,564 @@ CoreDumpGenerator::initialize(DumpConfiguration const &config, bool handleExcept
     if(config.getMaxSizeBytes() > 0)
       _logMessage("Max size: " + std::to_string(config.getMaxSizeBytes()) + " bytes", false);
 
-    // Initialize platform-specific handlers
-    _platformInitialize();
+    // Initialize platform-specific handlers
+    _platformInitialize();
+
+    // Setup exception handling if requested
+    if(handleExceptions) _setupExceptionHandling();
+
+    // Set initialized flag with release semantics to ensure all previous
+    // operations are visible
+#if CPP11_OR_GREATER
+    s_initialized.store(true, std::memory_order_release);
+#else
+    s_initialized = true;
+#endif
+    _logMessage("CoreDumpGenerator initialized successfully", false);
+
+    // Crash handlers are armed; core_pattern may wait on sudo, so it finishes in the background
+    s_setup.start(config.isDeferredSetup());
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to initialize CoreDumpGenerator: " + std::string(exc.what()), true);
+    throw;
+  }
+  catch(...)
+  {
+    _logMessage("Failed to initialize CoreDumpGenerator: Unknown error", true);
+    throw std::runtime_error("Unknown error during CoreDumpGenerator initialization");
+  }
+}
+
+CoreDumpGenerator &
+CoreDumpGenerator::instance()
+{
+#if CPP11_OR_GREATER
+  // Double-checked locking pattern for thread safety
+  if(!s_initialized.load(std::memory_order_acquire))
+    throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+
+  std::call_once(s_initFlag,
+                 []()
+                 {
+                   // Additional check inside call_once for extra safety
+                   if(!s_initialized.load(std::memory_order_acquire))
+                     throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+                   s_instance = std::unique_ptr<CoreDumpGenerator>(new CoreDumpGenerator());
+                 });
+#else
+  // C++98/03 fallback - not thread-safe
+  if(!s_instance)
+  {
+    if(!s_initialized) throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+  }
+#endif
+
+  return *s_instance;
+}
+
+bool
+CoreDumpGenerator::isInitialized() noexcept
+{
+#if CPP11_OR_GREATER
+  return s_initialized.load(std::memory_order_seq_cst);
+#else
+  return s_initialized;
+#endif
+}
+
+ReadinessState
+CoreDumpGenerator::getReadinessState() noexcept
+{
+  return s_setup.getState();
+}
+
+bool
+CoreDumpGenerator::waitUntilReady()
+{
+  return s_setup.wait();
+}
+
+bool
+CoreDumpGenerator::waitUntilReady(std::chrono::milliseconds timeout)
+{
+  return s_setup.waitFor(timeout);
+}
+
+bool
+CoreDumpGenerator::generateDump(std::string const &reason, DumpType dumpType)
+{
+#if CPP11_OR_GREATER
+  if(!s_initialized.load(std::memory_order_acquire))
+    throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+#else
+  if(!s_initialized) throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+#endif
+#if DUMP_CREATOR_UNIX
+  _checkCrashHelper();
+#endif
+
+  try
+  {
+    if(dumpType == DumpType::DEFAULT_AUTO)
+    {
+      // A copy, so no Reader is held while the dump runs
+      DumpConfiguration const config = ConfigStore::Reader(s_configStore)->m_config;
+      return s_scheduler.run(config, reason).m_success;
+    }
+
+    DumpConfiguration config = DumpFactory::createConfiguration(dumpType);
+    config.setDirectory(s_dumpDirectory); // Preserve current directory
+    return s_scheduler.run(config, reason).m_success;
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to generate dump: " + std::string(exc.what()), true);
+    return false;
+  }
+}
+
+bool
+CoreDumpGenerator::generateDump(DumpConfiguration const &config, std::string const &reason)
+{
+#if CPP11_OR_GREATER
+  if(!s_initialized.load(std::memory_order_acquire))
+    throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+#else
+  if(!s_initialized) throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+#endif
+#if DUMP_CREATOR_UNIX
+  _checkCrashHelper();
+#endif
+
+  try
+  {
+    return s_scheduler.run(config, reason).m_success;
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to generate dump: " + std::string(exc.what()), true);
+    return false;
+  }
+}
+
+std::shared_future<DumpResult>
+CoreDumpGenerator::generateDumpAsync(std::string const &reason, DumpPriority priority)
+{
+  ConfigStore::Reader const active(s_configStore);
+  return generateDumpAsync(active->m_config, reason, priority);
+}
+
+std::shared_future<DumpResult>
+CoreDumpGenerator::generateDumpAsync(DumpConfiguration const &config, std::string const &reason,
+                                     DumpPriority priority)
+{
+#if CPP11_OR_GREATER
+  if(!s_initialized.load(std::memory_order_acquire))
+    throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+#else
+  if(!s_initialized) throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+#endif
+#if DUMP_CREATOR_UNIX
+  _checkCrashHelper();
+#endif
+
+  return s_scheduler.submit(config, reason, priority);
+}
+
+DumpResult
+CoreDumpGenerator::_runDump(DumpConfiguration const &config, std::string const &reason) noexcept
+{
+  DumpResult result;
+  auto const started = std::chrono::steady_clock::now();
+  try
+  {
+    std::string filename = _generateDumpFilename(config.getType());
+    _logMessage("Generating dump: " + reason, false);
+    _logMessage("Dump type: " + DumpFactory::getDescription(config.getType()), false);
+
+#if DUMP_CREATOR_WINDOWS
+    result.m_success = _createWindowsDump(filename, config);
+#elif DUMP_CREATOR_UNIX
+    result.m_success = _createUnixDump(filename, config);
+#endif
+    if(!result.m_success) result.m_error = std::make_error_code(std::errc::io_error);
+  }
+  catch(std::system_error const &exc)
+  {
+    result.m_error = exc.code();
+    _logMessage("Failed to generate dump: " + std::string(exc.what()), true);
+  }
+  catch(std::exception const &exc)
+  {
+    result.m_error = std::make_error_code(std::errc::operation_canceled);
+    _logMessage("Failed to generate dump: " + std::string(exc.what()), true);
+  }
+  catch(...)
+  {
+    result.m_error = std::make_error_code(std::errc::operation_canceled);
+    _logMessage("Failed to generate dump: Unknown error", true);
+  }
+  result.m_dumpTime = std::chrono::steady_clock::now() - started;
+  return result;
+}
+
+// Configuration store implementation
+CoreDumpGenerator::ConfigStore::Reader::Reader(ConfigStore &store) noexcept
+    : m_slot(store.m_readers[store.m_epoch.load() & 1U])
+{
+  // Counted before the load, so a publish() that swaps the snapshot away afterwards sees this reader
+  m_slot.fetch_add(1);
+  m_snapshot = store.m_active.load();
+}
+
+CoreDumpGenerator::ConfigStore::Reader::~Reader() noexcept
+{
+  m_slot.fetch_sub(1);
+}
+
+CoreDumpGenerator::ConfigStore::~ConfigStore() noexcept
+{
+  delete m_active.load();
+}
+
+bool
+CoreDumpGenerator::ConfigStore::publish(DumpConfiguration const &config)
+{
+  // Everything that allocates happens before the swap
+  std::unique_ptr<ConfigSnapshot> snapshot(new ConfigSnapshot());
+  snapshot->m_config = config;
+  bool compiled      = true;
+#if DUMP_CREATOR_UNIX
+  compiled = snapshot->m_memoryFilter.compile(config.getMemoryFilters());
+#endif
+
+  std::lock_guard<std::mutex> lock(m_writerMutex);
+  m_retired.reserve(m_retired.size() + 1);
+  ConfigSnapshot const *const previous = m_active.exchange(snapshot.release());
+  m_retired.emplace_back(m_epoch.load(), std::unique_ptr<ConfigSnapshot const>(previous));
+  _reclaim();
+  return compiled;
+}
+
+void
+CoreDumpGenerator::ConfigStore::_reclaim() noexcept
+{
+  // A flip needs the slot it reuses empty: readers that started two epochs ago are gone
+  for(int flip = 0; flip < 2; ++flip)
+  {
+    std::uint32_t const epoch = m_epoch.load();
+    if(m_readers[(epoch + 1) & 1U].load() != 0) break;
+    m_epoch.store(epoch + 1);
+  }
+
+  std::uint32_t const epoch = m_epoch.load();
+  m_retired.erase(std::remove_if(m_retired.begin(), m_retired.end(),
+                                 [epoch](Retired const &retired) { return epoch - retired.first >= 2; }),
+                  m_retired.end());
+}
+
+// Deferred setup implementation
+CoreDumpGenerator::DeferredSetup::~DeferredSetup() noexcept
+{
+  if(m_thread.joinable()) m_thread.join(); // sudo runs with -n, so this never waits on a prompt
+}
+
+void
+CoreDumpGenerator::DeferredSetup::start(bool deferred) noexcept
+{
+  m_state.store(ReadinessState::ARMED, std::memory_order_release);
+  if(deferred)
+  {
+    try
+    {
+      m_thread = std::thread(&DeferredSetup::_finish, this);
+      return;
+    }
+    catch(std::exception const &exc)
+    {
+      _logMessage("WARNING: Cannot defer setup (" + std::string(exc.what()) + "), finishing it now", true);
+    }
+  }
+  _finish();
+}
+
+bool
+CoreDumpGenerator::DeferredSetup::wait()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_changed.wait(lock, [this]() { return _isSettled(); });
+  return getState() == ReadinessState::READY;
+}
 
-    // Setup exception handling if requested
-    if(handleExceptions) _setupExceptionHandling();
+bool
+CoreDumpGenerator::DeferredSetup::waitFor(std::chrono::milliseconds timeout)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_changed.wait_for(lock, timeout, [this]() { return _isSettled(); });
+  return getState() == ReadinessState::READY;
+}
 
-    // Set initialized flag with release semantics to ensure all previous
-    // operations are visible
-#if CPP11_OR_GREATER
-    s_initialized.store(true, std::memory_order_release);
-#else
-    s_initialized = true;
-#endif
-    _logMessage("CoreDumpGenerator initialized successfully", false);
-  }
-  catch(std::exception const &exc)
+bool
+CoreDumpGenerator::DeferredSetup::_isSettled() const noexcept
+{
+  // UNINITIALIZED settles at once: waitUntilReady() is only meaningful once initialize() has returned
+  return getState() != ReadinessState::ARMED;
+}
+
+void
+CoreDumpGenerator::DeferredSetup::_finish() noexcept
+{
+  auto const started = std::chrono::steady_clock::now();
+  _completePlatformInitialize();
   {
-    _logMessage("Failed to initialize CoreDumpGenerator: " + std::string(exc.what()), true);
-    throw;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_state.store(ReadinessState::READY, std::memory_order_release);
   }
-  catch(...)
+  m_changed.notify_all();
+  auto const elapsed = std::chrono::steady_clock::now() - started;
+  _logMessage("CoreDumpGenerator ready (setup took "
+                + std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()) + " ms)",
+              false);
+}
+
+// Dump scheduler implementation
+CoreDumpGenerator::DumpScheduler::~DumpScheduler() noexcept
+{
+  std::vector<CapturePointer> abandoned;
   {
-    _logMessage("Failed to initialize CoreDumpGenerator: Unknown error", true);
-    throw std::runtime_error("Unknown error during CoreDumpGenerator initialization");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+    abandoned.swap(m_pending);
   }
+  m_changed.notify_all();
+  for(auto &capture : abandoned) _complete(*capture, std::errc::operation_canceled);
+  if(m_worker.joinable()) m_worker.join(); // Lets a running dump finish
 }
 
-CoreDumpGenerator &
-CoreDumpGenerator::instance()
+std::shared_future<DumpResult>
+CoreDumpGenerator::DumpScheduler::submit(DumpConfiguration const &config, std::string const &reason,
+                                         DumpPriority priority)
 {
-#if CPP11_OR_GREATER
-  // Double-checked locking pattern for thread safety
-  if(!s_initialized.load(std::memory_order_acquire))
-    throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+  // Everything that allocates happens before the lock
+  CapturePointer capture = std::make_shared<Capture>(config);
+  capture->m_reasons.push_back(reason);
+  capture->m_priority                   = priority;
+  std::shared_future<DumpResult> future = capture->m_future;
 
-  std::call_once(s_initFlag,
-                 []()
-                 {
-                   // Additional check inside call_once for extra safety
-                   if(!s_initialized.load(std::memory_order_acquire))
-                     throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
-                   s_instance = std::unique_ptr<CoreDumpGenerator>(new CoreDumpGenerator());
-                 });
-#else
-  // C++98/03 fallback - not thread-safe
-  if(!s_instance)
+  CapturePointer rejected;
+  std::errc rejection = std::errc::resource_unavailable_try_again;
   {
-    if(!s_initialized) throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CapturePointer const joined = m_stopping ? nullptr : _attach(config, reason, priority);
+    if(joined) return joined->m_future;
+
+    if(m_stopping)
+    {
+      rejected  = std::move(capture);
+      rejection = std::errc::operation_canceled;
+    }
+    else
+    {
+      if(!m_worker.joinable()) m_worker = std::thread(&DumpScheduler::_workerLoop, this);
+      if(m_pending.size() >= MAX_PENDING_DUMPS)
+      {
+        // Make room by dropping the request that would be served last, if the new one outranks it
+        auto const last = std::min_element(m_pending.begin(), m_pending.end(), _servedLater);
+        if((*last)->m_priority < priority)
+        {
+          rejected = std::move(*last);
+          m_pending.erase(last);
+          std::make_heap(m_pending.begin(), m_pending.end(), _servedLater);
+        }
+        else
+        {
+          rejected = std::move(capture);
+        }
+      }
+      if(capture)
+      {
+        capture->m_sequence = m_nextSequence++;
+        m_pending.push_back(std::move(capture));
+        std::push_heap(m_pending.begin(), m_pending.end(), _servedLater);
+      }
+    }
   }
-#endif
+  m_changed.notify_one();
 
-  return *s_instance;
+  if(rejected)
+  {
+    _logMessage("Dump request not queued: " + rejected->m_reasons.front(), true);
+    _complete(*rejected, rejection);
+  }
+  return future;
 }
 
-bool
-CoreDumpGenerator::isInitialized() noexcept
+DumpResult
+CoreDumpGenerator::DumpScheduler::run(DumpConfiguration const &config, std::string const &reason)
 {
-#if CPP11_OR_GREATER
-  return s_initialized.load(std::memory_order_seq_cst);
-#else
-  return s_initialized;
-#endif
+  CapturePointer capture = std::make_shared<Capture>(config);
+  capture->m_reasons.push_back(reason);
+  CapturePointer joined;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running.reserve(m_running.size() + 1); // The pushes below cannot throw once a capture left m_pending
+    auto const queued = std::find_if(m_pending.begin(), m_pending.end(),
+                                     [&config](CapturePointer const &pending) { return pending->m_config == config; });
+    if(queued != m_pending.end())
+    {
+      // Write the queued capture here, for its requests as well
+      capture = std::move(*queued);
+      m_pending.erase(queued);
+      std::make_heap(m_pending.begin(), m_pending.end(), _servedLater);
+      capture->m_reasons.push_back(reason);
+    }
+    else
+    {
+      joined = _attach(config, reason, DumpPriority::NORMAL);
+    }
+    if(!joined) m_running.push_back(capture); // Requests with this configuration now wait for this dump
+  }
+  return joined ? joined->m_future.get() : _execute(capture);
 }
 
-bool
-CoreDumpGenerator::generateDump(std::string const &reason, DumpType dumpType)
+CoreDumpGenerator::DumpScheduler::CapturePointer
+CoreDumpGenerator::DumpScheduler::_attach(DumpConfiguration const &config, std::string const &reason,
+                                          DumpPriority priority)
 {
-#if CPP11_OR_GREATER
-  if(!s_initialized.load(std::memory_order_acquire))
-    throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
-#else
-  if(!s_initialized) throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
-#endif
+  auto const now = std::chrono::steady_clock::now();
+  m_finished.erase(std::remove_if(m_finished.begin(), m_finished.end(),
+                                  [now](CapturePointer const &capture) {
+                                    return now - capture->m_finished > capture->m_config.getCoalescingWindow();
+                                  }),
+                   m_finished.end());
+
+  for(auto const &capture : m_finished)
+    if(capture->m_config == config) return capture; // Already delivered: the reason no longer reaches the result
+  for(auto const &capture : m_running)
+  {
+    if(capture->m_config != config) continue;
+    capture->m_reasons.push_back(reason);
+    return capture;
+  }
+  for(auto const &capture : m_pending)
+  {
+    if(capture->m_config != config) continue;
+    capture->m_reasons.push_back(reason);
+    if(capture->m_priority < priority)
+    {
+      capture->m_priority = priority;
+      std::make_heap(m_pending.begin(), m_pending.end(), _servedLater);
+    }
+    return capture;
+  }
+  return nullptr;
+}
 
-  try
+DumpResult
+CoreDumpGenerator::DumpScheduler::_execute(CapturePointer const &capture) noexcept
+{
+  std::string reasons;
+  std::chrono::steady_clock::duration queueTime{};
   {
-    DumpConfiguration config = s_currentConfig;
-    if(dumpType != DumpType::DEFAULT_AUTO)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    queueTime = std::chrono::steady_clock::now() - capture->m_queued;
+    try
     {
-      config = DumpFactory::createConfiguration(dumpType);
-      config.setDirectory(s_dumpDirectory); // Preserve current directory
+      for(auto const &reason : capture->m_reasons) reasons += (reasons.empty() ? "" : "; ") + reason;
+    }
+    catch(...)
+    {
+      // The log line loses reasons, the result keeps them
     }
+  }
 
-    std::string filename = _generateDumpFilename(config.getType());
-    _logMessage("Generating dump: " + reason, false);
-    _logMessage("Dump type: " + DumpFactory::getDescription(config.getType()), false);
+  DumpResult result  = _runDump(capture->m_config, reasons);
+  result.m_queueTime = queueTime;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    result.m_reasons.swap(capture->m_reasons);
+    m_running.erase(std::remove(m_running.begin(), m_running.end(), capture), m_running.end());
+    capture->m_finished = std::chrono::steady_clock::now();
+    if(capture->m_config.getCoalescingWindow().count() > 0)
+    {
+      try
+      {
+        m_finished.push_back(capture);
+      }
+      catch(...)
+      {
+        // Later requests simply start a new dump
+      }
+    }
+  }
+  if(result.m_reasons.size() > 1)
+    _logMessage("Dump served " + std::to_string(result.m_reasons.size()) + " coalesced requests", false);
 
-#if DUMP_CREATOR_WINDOWS
-    return _createWindowsDump(filename, config);
-#elif DUMP_CREATOR_UNIX
-    _generateCoreDump();
-    _logCoreDumpSize(filename);
-    return true;
-#endif
+  try
+  {
+    capture->m_promise.set_value(result);
   }
-  catch(std::exception const &exc)
+  catch(...)
   {
-    _logMessage("Failed to generate dump: " + std::string(exc.what()), true);
-    return false;
+    // Only fails if the promise was already satisfied
   }
+  return result;
 }
 
 bool
-CoreDumpGenerator::generateDump(DumpConfiguration const &config, std::string const &reason)
+CoreDumpGenerator::DumpScheduler::_servedLater(CapturePointer const &lhs, CapturePointer const &rhs) noexcept
 {
-#if CPP11_OR_GREATER
-  if(!s_initialized.load(std::memory_order_acquire))
-    throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
-#else
-  if(!s_initialized) throw std::runtime_error("CoreDumpGenerator not initialized. Call initialize() first.");
-#endif
+  if(lhs->m_priority != rhs->m_priority) return lhs->m_priority < rhs->m_priority;
+  return lhs->m_sequence > rhs->m_sequence;
+}
 
+void
+CoreDumpGenerator::DumpScheduler::_complete(Capture &capture, std::errc error) noexcept
+{
   try
   {
-    std::string filename = _generateDumpFilename(config.getType());
-    _logMessage("Generating dump: " + reason, false);
-    _logMessage("Dump type: " + DumpFactory::getDescription(config.getType()), false);
-
-#if DUMP_CREATOR_WINDOWS
-    return _createWindowsDump(filename, config);
-#elif DUMP_CREATOR_UNIX
-    _generateCoreDump();
-    _logCoreDumpSize(filename);
-    return true;
-#endif
+    DumpResult result;
+    result.m_error = std::make_error_code(error);
+    result.m_reasons.swap(capture.m_reasons);
+    capture.m_promise.set_value(std::move(result));
   }
-  catch(std::exception const &exc)
+  catch(...)
   {
-    _logMessage("Failed to generate dump: " + std::string(exc.what()), true);
-    return false;
+    // Only fails if the promise was already satisfied
+  }
+}
+
+void
+CoreDumpGenerator::DumpScheduler::_workerLoop() noexcept
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for(;;)
+  {
+    m_changed.wait(lock, [this]() { return m_stopping || !m_pending.empty(); });
+    if(m_stopping) return;
+
+    std::pop_heap(m_pending.begin(), m_pending.end(), _servedLater);
+    CapturePointer capture = std::move(m_pending.back());
+    m_pending.pop_back();
+    try
+    {
+      m_running.push_back(capture);
+    }
+    catch(...)
+    {
+      lock.unlock();
+      _complete(*capture, std::errc::not_enough_memory);
+      lock.lock();
+      continue;
+    }
+    lock.unlock();
+
+    _execute(capture);
+    capture.reset(); // Frees the configuration outside the lock
+
+    lock.lock();
   }
 }
 
@@ -2132,24 +7673,21 @@ CoreDumpGenerator::generateDump(std::string const &reason, DumpType dumpType, st
       return false;
     }
 
-    DumpConfiguration config = s_currentConfig;
-    if(dumpType != DumpType::DEFAULT_AUTO)
+    DumpResult result;
+    if(dumpType == DumpType::DEFAULT_AUTO)
     {
-      config = DumpFactory::createConfiguration(dumpType);
+      // A copy, so no Reader is held while the dump runs
+      DumpConfiguration const config = ConfigStore::Reader(s_configStore)->m_config;
+      result                         = s_scheduler.run(config, reason);
+    }
+    else
+    {
+      DumpConfiguration config = DumpFactory::createConfiguration(dumpType);
       config.setDirectory(s_dumpDirectory); // Preserve current directory
+      result = s_scheduler.run(config, reason);
     }
-
-    std::string filename = _generateDumpFilename(config.getType());
-    _logMessage("Generating dump: " + reason, false);
-    _logMessage("Dump type: " + DumpFactory::getDescription(config.getType()), false);
-
-#if DUMP_CREATOR_WINDOWS
-    return _createWindowsDump(filename, config);
-#elif DUMP_CREATOR_UNIX
-    _generateCoreDump();
-    _logCoreDumpSize(filename);
-    return true;
-#endif
+    errorCode = result.m_error;
+    return result.m_success;
   }
   catch(std::system_error const &exc)
   {
@@ -2181,8 +7719,8 @@ CoreDumpGenerator::getDumpDirectory() noexcept
 DumpConfiguration
 CoreDumpGenerator::getCurrentConfiguration() noexcept
 {
-  return s_currentConfig; // s_currentConfig is only modified during
-                          // initialization, which is single-threaded
+  ConfigStore::Reader const active(s_configStore);
+  return active->m_config;
 }
 
 bool
@@ -2203,16 +7741,17 @@ CoreDumpGenerator::setDumpType(DumpType dumpType)
     return false;
   }
 
-  s_currentConfig = DumpFactory::createConfiguration(dumpType);
-  s_currentConfig.setDirectory(s_dumpDirectory); // Preserve current directory
+  DumpConfiguration config = DumpFactory::createConfiguration(dumpType);
+  config.setDirectory(s_dumpDirectory); // Preserve current directory
+  s_configStore.publish(config);        // Dumps already running keep the configuration they started with
   return true;
 }
 
 DumpType
 CoreDumpGenerator::getCurrentDumpType() noexcept
 {
-  return s_currentConfig.getType(); // s_currentConfig is only modified during
-                                    // initialization, which is single-threaded
+  ConfigStore::Reader const active(s_configStore);
+  return active->m_config.getType();
 }
 
 void
@@ -2297,6 +7836,232 @@ CoreDumpGenerator::registerCustomSignalHandler(int signum, void (*handler)(int))
 #endif
 }
 
+bool
+CoreDumpGenerator::registerThread() noexcept
+{
+#if DUMP_CREATOR_UNIX
+  return CoreDumpEngine::AltStackLease::current().install();
+#elif DUMP_CREATOR_WINDOWS
+  ULONG guarantee = 64 * 1024; // Stack kept in reserve for the exception filter
+  return SetThreadStackGuarantee(&guarantee) != FALSE;
+#else
+  return false; // Unsupported platform
+#endif
+}
+
+void
+CoreDumpGenerator::unregisterThread() noexcept
+{
+#if DUMP_CREATOR_UNIX
+  CoreDumpEngine::AltStackLease::current().uninstall();
+#endif
+}
+
+bool
+CoreDumpGenerator::excludeRegion(void const *address, size_t size, char const *label) noexcept
+{
+#if DUMP_CREATOR_UNIX
+  std::uintptr_t start = 0;
+  std::uintptr_t end   = 0;
+  if(!CoreDumpEngine::wholePages(address, size, start, end)) return false;
+  madvise(reinterpret_cast<void *>(start), end - start, MADV_DONTDUMP); // Best effort, e.g. ENOMEM on holes
+  return CoreDumpEngine::ExclusionRegistry::instance().add(start, end, label);
+#else
+  (void)address;
+  (void)size;
+  (void)label;
+  return false;
+#endif
+}
+
+bool
+CoreDumpGenerator::includeRegion(void const *address, size_t size) noexcept
+{
+#if DUMP_CREATOR_UNIX
+  std::uintptr_t start = 0;
+  std::uintptr_t end   = 0;
+  if(!CoreDumpEngine::wholePages(address, size, start, end)) return false;
+  madvise(reinterpret_cast<void *>(start), end - start, MADV_DODUMP);
+  return CoreDumpEngine::ExclusionRegistry::instance().remove(start, end);
+#else
+  (void)address;
+  (void)size;
+  return false;
+#endif
+}
+
+bool
+CoreDumpGenerator::runCrashHelper(int argc, char **argv) noexcept
+{
+#if DUMP_CREATOR_UNIX
+  if(argc < 2 || argv == nullptr || argv[1] == nullptr
+     || std::strcmp(argv[1], CoreDumpEngine::Constants::CRASH_HELPER_ARGUMENT) != 0)
+    return false;
+  _exit(_serveCrashHelper(CoreDumpEngine::Constants::CRASH_HELPER_FD) ? EXIT_SUCCESS : EXIT_FAILURE);
+#else
+  (void)argc;
+  (void)argv;
+  return false;
+#endif
+}
+
+bool
+CoreDumpGenerator::runCorePatternHelper(int argc, char **argv) noexcept
+{
+#if DUMP_CREATOR_UNIX
+  // <helper> <directory> <codec>[:<level>]|none %t %p %s %u %g %e (%e may have been split at spaces)
+  if(argc < 9 || argv == nullptr) return false;
+  try
+  {
+    auto const started = std::chrono::steady_clock::now();
+    std::string const directory   = argv[1];
+    std::string const compression = argv[2];
+    auto const crashTime          = std::strtoull(argv[3], nullptr, 10);
+    auto const pid                = std::strtol(argv[4], nullptr, 10);
+    auto const signum             = std::strtol(argv[5], nullptr, 10);
+    auto const uid                = static_cast<uid_t>(std::strtoul(argv[6], nullptr, 10));
+    auto const gid                = static_cast<gid_t>(std::strtoul(argv[7], nullptr, 10));
+    std::string executable        = argv[8];
+    for(int index = 9; index < argc; ++index) executable += std::string(" ") + argv[index];
+
+    CompressionCodec codec = CompressionCodec::ZSTD;
+    int level              = 0;
+    bool compress          = compression != "none";
+    if(compress)
+    {
+      size_t const colon = compression.find(':');
+      if(compression.compare(0, colon, "lz4") == 0) codec = CompressionCodec::LZ4;
+      if(colon != std::string::npos) level = std::atoi(compression.c_str() + colon + 1);
+      compress = CoreDumpEngine::isCompressionAvailable(codec);
+    }
+
+    // A larger pipe lets the kernel hand the core over in fewer, larger writes
+    fcntl(STDIN_FILENO, F_SETPIPE_SZ, static_cast<int>(CoreDumpEngine::Constants::CORE_PIPE_SIZE));
+
+    // The dump directory belongs to the crashed process's user; touch it with that user's rights only, so a
+    // planted symlink or hard link cannot redirect a root-owned write
+    if(geteuid() == 0 && uid != 0
+       && (setgroups(0, nullptr) != 0 || setresgid(gid, gid, gid) != 0 || setresuid(uid, uid, uid) != 0))
+      return false;
+    int const dirFd = open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if(dirFd < 0) return false;
+    struct DirectoryCloser {
+      int fd;
+      explicit DirectoryCloser(int descriptor) : fd(descriptor) {}
+      ~DirectoryCloser()
+      {
+        close(fd);
+      }
+    } dirCloser(dirFd);
+
+    std::string safeExecutable = executable;
+    for(char &c : safeExecutable)
+      if(c == '/' || static_cast<unsigned char>(c) < 0x20) c = '_';
+    std::string const stem
+      = "core_dump_full_" + std::to_string(crashTime) + "_" + std::to_string(pid) + "_" + safeExecutable;
+    std::string const filename
+      = stem + ".core" + (compress ? CoreDumpEngine::compressionExtension(codec) : "");
+    std::string const partialFilename = filename + ".partial";
+    int fd = openat(dirFd, partialFilename.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_NOFOLLOW | O_CLOEXEC, 0640);
+    if(fd < 0) return false;
+
+    // Same owner as a core the kernel writes itself; a no-op once the privileges were dropped above
+    if(fchown(fd, uid, gid) != 0 && errno != EPERM)
+      _logMessage("Failed to hand " + filename + " to uid " + argv[6] + ": " + std::strerror(errno), true);
+
+    size_t const workerCount = std::max(1U, std::thread::hardware_concurrency()) - 1;
+    std::unique_ptr<CoreDumpEngine::OutputSink> sink
+      = CoreDumpEngine::createOutputSink(fd, compress, codec, level, workerCount, true);
+    size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<char> buffer(CoreDumpEngine::Constants::COPY_CHUNK_SIZE);
+    std::uint64_t coreBytes = 0;
+    bool written            = sink != nullptr;
+    bool endOfCore          = false;
+    while(written && !endOfCore)
+    {
+      // Fill whole chunks so zero pages are detected on page boundaries
+      size_t filled = 0;
+      while(filled < buffer.size())
+      {
+        ssize_t const bytesRead = read(STDIN_FILENO, buffer.data() + filled, buffer.size() - filled);
+        if(bytesRead < 0 && errno == EINTR) continue;
+        if(bytesRead <= 0)
+        {
+          written   = bytesRead == 0;
+          endOfCore = true;
+          break;
+        }
+        filled += static_cast<size_t>(bytesRead);
+      }
+      if(filled > 0)
+        written = (sink->supportsHoles() ? CoreDumpEngine::writeSparse(*sink, buffer.data(), filled, pageSize)
+                                         : sink->write(buffer.data(), filled))
+                  && written;
+      coreBytes += filled;
+    }
+    written                           = written && sink->finish();
+    std::uint64_t const holeBytes     = sink ? sink->getHoleBytes() : 0;
+    std::uint64_t const bytesWritten  = sink ? sink->getBytesWritten() : 0;
+    sink.reset(); // Joins the compression threads before the descriptor is closed
+    written = (close(fd) == 0) && written && renameat(dirFd, partialFilename.c_str(), dirFd, filename.c_str()) == 0;
+    if(!written)
+    {
+      unlinkat(dirFd, partialFilename.c_str(), 0);
+      return false;
+    }
+
+    double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    auto const quote = [](std::string const &text)
+    {
+      std::string quoted = "\"";
+      for(char const c : text)
+      {
+        if(c == '"' || c == '\\') quoted += '\\';
+        quoted += static_cast<unsigned char>(c) < 0x20 ? '?' : c;
+      }
+      return quoted + "\"";
+    };
+    std::ostringstream metadata;
+    metadata << "{\"core\": " << quote(filename) << ", \"pid\": " << pid
+             << ", \"signal\": " << signum << ", \"time\": " << crashTime << ", \"uid\": " << uid
+             << ", \"gid\": " << gid << ", \"executable\": " << quote(executable) << ", \"compression\": \""
+             << (compress ? (codec == CompressionCodec::LZ4 ? "lz4" : "zstd") : "none") << "\", \"core_bytes\": "
+             << coreBytes << ", \"file_bytes\": " << bytesWritten + holeBytes << ", \"hole_bytes\": " << holeBytes
+             << ", \"seconds\": " << seconds << ", \"mb_per_second\": "
+             << (seconds > 0 ? static_cast<double>(coreBytes) / MB_1 / seconds : 0.0) << "}\n";
+    std::string const json = metadata.str();
+    int const metadataFd
+      = openat(dirFd, (stem + ".json").c_str(), O_CREAT | O_EXCL | O_WRONLY | O_NOFOLLOW | O_CLOEXEC, 0640);
+    if(metadataFd < 0)
+    {
+      _logMessage("Failed to create metadata for " + filename + ": " + std::strerror(errno), true);
+      return true;
+    }
+    if(fchown(metadataFd, uid, gid) != 0 && errno != EPERM)
+      _logMessage("Failed to hand " + stem + ".json to uid " + argv[6] + ": " + std::strerror(errno), true);
+    size_t offset = 0;
+    while(offset < json.size())
+    {
+      ssize_t const bytes = write(metadataFd, json.data() + offset, json.size() - offset);
+      if(bytes < 0 && errno == EINTR) continue;
+      if(bytes <= 0) break;
+      offset += static_cast<size_t>(bytes);
+    }
+    if(close(metadataFd) != 0 || offset != json.size())
+      _logMessage("Failed to write metadata for " + filename, true);
+    return true;
+  }
+  catch(...)
+  {
+    return false;
+  }
+#else
+  (void)argc;
+  (void)argv;
+  return false;
+#endif
+}
+
 #if DUMP_CREATOR_WINDOWS
 bool
 CoreDumpGenerator::registerCustomConsoleHandler(BOOL(WINAPI *handler)(DWORD)) noexcept
@@ -2339,13 +8104,17 @@ CoreDumpGenerator::isInstanceInitialized() const noexcept
 bool
 CoreDumpGenerator::generateInstanceDump(std::string const &reason)
 {
-  std::lock_guard<std::mutex> lock(m_instanceMutex);
-
-  if(!m_isInitialized) return false;
+  // Only the configuration is read under the lock; the dump itself runs without it
+  DumpType dumpType = DumpType::DEFAULT_AUTO;
+  {
+    std::lock_guard<std::mutex> lock(m_instanceMutex);
+    if(!m_isInitialized) return false;
+    dumpType = m_currentConfig.getType();
+  }
 
   try
   {
-    return generateDump(reason, m_currentConfig.getType());
+    return generateDump(reason, dumpType);
   }
   catch(...)
   {
@@ -2356,17 +8125,20 @@ CoreDumpGenerator::generateInstanceDump(std::string const &reason)
 bool
 CoreDumpGenerator::generateInstanceDump(std::string const &reason, std::error_code &errorCode) noexcept
 {
-  std::lock_guard<std::mutex> lock(m_instanceMutex);
-
-  if(!m_isInitialized)
+  DumpType dumpType = DumpType::DEFAULT_AUTO;
   {
-    errorCode = std::make_error_code(std::errc::invalid_argument);
-    return false;
+    std::lock_guard<std::mutex> lock(m_instanceMutex);
+    if(!m_isInitialized)
+    {
+      errorCode = std::make_error_code(std::errc::invalid_argument);
+      return false;
+    }
+    dumpType = m_currentConfig.getType();
   }
 
   try
   {
-    return generateDump(reason, m_currentConfig.getType(), errorCode);
+    return generateDump(reason, dumpType, errorCode);
   }
   catch(...)
   {
@@ -2394,7 +8166,11 @@ CoreDumpGenerator::_acquireOperationSlot() noexcept
 inline void
 CoreDumpGenerator::_releaseOperationSlot() noexcept
 {
-  s_activeOperations.fetch_sub(1, std::memory_order_release);
+  {
+    // Under the mutex, so a waiter cannot check the count and then miss this notification
+    std::lock_guard<std::mutex> lock(s_operationMutex);
+    s_activeOperations.fetch_sub(1, std::memory_order_release);
+  }
   s_operationCondition.notify_one();
 }
 
@@ -2441,12 +8217,32 @@ CoreDumpGenerator::_updateCache() const noexcept
 // OperationGuard implementation
 inline CoreDumpGenerator::OperationGuard::OperationGuard() noexcept
 {
-  m_acquired = _acquireOperationSlot();
-  if(!m_acquired)
+  // A freed slot can be taken by a non-blocking guard before this one wakes up; wait again until one is held
+  while(!(m_acquired = _acquireOperationSlot())) _waitForOperationSlot();
+}
+
+inline CoreDumpGenerator::OperationGuard::OperationGuard(std::try_to_lock_t) noexcept
+    : m_acquired(_acquireOperationSlot())
+{}
+
+inline size_t
+CoreDumpGenerator::_reserveOperationSlots(OperationGuards &guards, bool compress)
+{
+  guards.emplace_back(new OperationGuard());
+  if(!compress) return 0;
+
+  size_t const hardwareThreads = std::thread::hardware_concurrency();
+  size_t const maxOperations   = MAX_CONCURRENT_OPERATIONS; // Copy: std::min binds by reference
+  size_t const wanted          = std::min(hardwareThreads, maxOperations);
+  while(guards.size() < wanted)
   {
-    _waitForOperationSlot();
-    m_acquired = _acquireOperationSlot();
+    std::unique_ptr<OperationGuard> guard(new OperationGuard(std::try_to_lock));
+    if(!guard->isAcquired()) break;
+    guards.push_back(std::move(guard));
   }
+
+  // A single hardware thread gains nothing from a pipeline; the dump's own slot is not a worker
+  return hardwareThreads <= 1 ? 0 : std::max<size_t>(guards.size() - 1, 1);
 }
 
 inline CoreDumpGenerator::OperationGuard::~OperationGuard() noexcept
@@ -2459,7 +8255,9 @@ inline void
 CoreDumpGenerator::_startPerformanceMonitoring(PerformanceMetrics &metrics) noexcept
 {
   metrics.m_startTime = std::chrono::high_resolution_clock::now();
+  metrics.m_forkPause = std::chrono::nanoseconds(0);
   metrics.m_success   = false;
+  metrics.m_snapshot  = false;
   metrics.m_dumpSize  = 0;
 }
 
@@ -2478,7 +8276,12 @@ CoreDumpGenerator::_logPerformanceMetrics(PerformanceMetrics const &metrics) noe
   std::string message = "Performance: " + std::to_string(duration.count())
                         + "ms, Size: " + std::to_string(metrics.m_dumpSize)
                         + " bytes, Success: " + (metrics.m_success ? "true" : "false");
-  _logMessage(message, LogLevel::INFO_);
+  if(metrics.m_snapshot)
+  {
+    auto pause = std::chrono::duration_cast<std::chrono::microseconds>(metrics.m_forkPause);
+    message += ", Fork pause: " + std::to_string(pause.count()) + "us";
+  }
+  _logMessage(message, !metrics.m_success);
 }
 
 // Private implementation
@@ -2488,82 +8291,96 @@ CoreDumpGenerator::_platformInitialize()
 #if DUMP_CREATOR_WINDOWS
   _setupWindowsHandlers();
 #elif DUMP_CREATOR_UNIX
+  _prepareCrashPath();
+  if(ConfigStore::Reader(s_configStore)->m_config.isCrashHelper()) _startCrashHelper();
+  if(!registerThread()) _logMessage("WARNING: No alternate signal stack, stack overflows will not be dumped", true);
   _setupSignalHandlers();
   _setupCoreDumpSettings();
+#endif
+}
 
-  // Store orig core_pattern BEFORE attempting to change it
-  _setupCorePattern();
-  std::string pattern_before_change = s_originalCorePattern;
-
-  // Try to set custom core_pattern via sudo (primary mechanism)
-  _generateCoreDump();
-
-  // Verify if core_pattern actually changed with kernel specifiers
-  std::ifstream check_pattern("/proc/sys/kernel/core_pattern");
-  std::string pattern_after_change;
-
-  if(std::getline(check_pattern, pattern_after_change))
+void
+CoreDumpGenerator::_completePlatformInitialize() noexcept
+{
+#if DUMP_CREATOR_UNIX
+  try
   {
-    // Check for our pattern with kernel specifiers: %t, %p, %e
-    bool has_kernel_specifiers
-      = (pattern_after_change.find("%t") != std::string::npos && pattern_after_change.find("%p") != std::string::npos
-         && pattern_after_change.find("%e") != std::string::npos);
+    // Store orig core_pattern BEFORE attempting to change it
+    _setupCorePattern();
+    std::string pattern_before_change = s_originalCorePattern;
 
-    bool has_our_directory = (pattern_after_change.find(s_dumpDirectory) != std::string::npos);
+    // Try to set custom core_pattern (direct write, then non-interactive sudo)
+    _generateCoreDump();
 
-    if(has_kernel_specifiers && has_our_directory)
-    {
-      _logMessage("SUCCESS: Custom core_pattern set successfully", false);
-      _logMessage("  Dumps will be created directly in: " + s_dumpDirectory, false);
-      _logMessage("  Pattern: " + pattern_after_change, false);
-    }
-    else
+    // Verify if core_pattern actually changed with kernel specifiers
+    std::ifstream check_pattern("/proc/sys/kernel/core_pattern");
+    std::string pattern_after_change;
+
+    if(std::getline(check_pattern, pattern_after_change))
     {
-      _logMessage("WARNING: core_pattern did not change to our pattern (sudo likely failed)", false);
+      // Check for our pattern with kernel specifiers: %t, %p, %e
+      bool has_kernel_specifiers = (pattern_after_change.find("%t") != std::string::npos
+                                    && pattern_after_change.find("%p") != std::string::npos
+                                    && pattern_after_change.find("%e") != std::string::npos);
+
+      bool has_our_directory = (pattern_after_change.find(s_dumpDirectory) != std::string::npos);
 
-      // Try to restore original systemd-coredump pattern if it was active before
-      // This prevents leaving stale pattern from previous run
-      if(!pattern_before_change.empty() && pattern_before_change[0] == '|'
-         && pattern_before_change.find("systemd-coredump") != std::string::npos)
+      if(has_kernel_specifiers && has_our_directory)
       {
-        _logMessage("INFO: Attempting to restore original systemd-coredump pattern", false);
-        std::string restore_cmd
-          = "echo \"" + pattern_before_change + "\" | sudo tee /proc/sys/kernel/core_pattern >/dev/null 2>&1";
-        int restore_ret = system(restore_cmd.c_str());
+        _logMessage("SUCCESS: Custom core_pattern set successfully", false);
+        _logMessage("  Dumps will be created directly in: " + s_dumpDirectory, false);
+        _logMessage("  Pattern: " + pattern_after_change, false);
+      }
+      else
+      {
+        _logMessage("WARNING: core_pattern did not change to our pattern (sudo likely failed)", false);
 
-        if(restore_ret == 0)
+        // Try to restore original systemd-coredump pattern if it was active before
+        // This prevents leaving stale pattern from previous run
+        if(!pattern_before_change.empty() && pattern_before_change[0] == '|'
+           && pattern_before_change.find("systemd-coredump") != std::string::npos)
         {
-          _logMessage("INFO: Successfully restored systemd-coredump pattern", false);
-          pattern_after_change = pattern_before_change; // Update for subsequent checks
+          _logMessage("INFO: Attempting to restore original systemd-coredump pattern", false);
+          if(_writeCorePatternWithSudo(pattern_before_change))
+          {
+            _logMessage("INFO: Successfully restored systemd-coredump pattern", false);
+            pattern_after_change = pattern_before_change; // Update for subsequent checks
+          }
         }
-      }
 
-      // Check if systemd-coredump is active (either originally or after restore)
-      if(!pattern_after_change.empty() && pattern_after_change[0] == '|'
-         && pattern_after_change.find("systemd-coredump") != std::string::npos)
-      {
-        // systemd-coredump is active -> start fallback monitor
-        try
+        // Check if systemd-coredump is active (either originally or after restore)
+        if(!pattern_after_change.empty() && pattern_after_change[0] == '|'
+           && pattern_after_change.find("systemd-coredump") != std::string::npos)
         {
-          s_monitorThreadShouldStop.store(false, std::memory_order_release);
-          s_monitorThread = std::thread(_instantSystemdMonitor);
-          _logMessage("INFO: Using systemd-coredump with instant extraction fallback", false);
-          _logMessage("  Dumps will be extracted from systemd to: " + s_dumpDirectory, false);
+          // systemd-coredump is active -> start fallback monitor
+          try
+          {
+            s_monitorWakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if(s_monitorWakeFd < 0) throw std::runtime_error("eventfd() failed: " + std::string(strerror(errno)));
+            s_monitorThreadShouldStop.store(false, std::memory_order_release);
+            s_monitorThread = std::thread(_instantSystemdMonitor);
+            _logMessage("INFO: Using systemd-coredump with instant extraction fallback", false);
+            _logMessage("  Dumps will be extracted from systemd to: " + s_dumpDirectory, false);
+          }
+          catch(std::exception const &exc)
+          {
+            _stopSystemdMonitor();
+            _logMessage("Failed to start systemd fallback monitor: " + std::string(exc.what()), true);
+          }
         }
-        catch(std::exception const &exc)
+        else
         {
-          _logMessage("Failed to start systemd fallback monitor: " + std::string(exc.what()), true);
+          _logMessage("WARNING: Using system default core_pattern", false);
+          _logMessage("  Current pattern: " + pattern_after_change, false);
+          _logMessage("  Dumps may be created in current directory or other system location", false);
         }
       }
-      else
-      {
-        _logMessage("WARNING: Using system default core_pattern", false);
-        _logMessage("  Current pattern: " + pattern_after_change, false);
-        _logMessage("  Dumps may be created in current directory or other system location", false);
-      }
     }
   }
-
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to complete initialization: " + std::string(exc.what()), true);
+  }
 #endif
 }
 
@@ -2617,7 +8434,7 @@ CoreDumpGenerator::_windowsExceptionHandler(EXCEPTION_POINTERS *pExInfo) noexcep
 
     // Generate filename using thread-safe time formatting with dump type
     std::string timeStr     = formatTime("%d.%m.%Y.%H.%M.%S");
-    std::string dumpTypeStr = dumpTypeToString(s_currentConfig.getType());
+    std::string dumpTypeStr = dumpTypeToString(ConfigStore::Reader(s_configStore)->m_config.getType());
 
     // Sanitize time string to prevent command injection
     std::string sanitizedTimeStr;
@@ -2707,7 +8524,7 @@ CoreDumpGenerator::_windowsExceptionHandler(EXCEPTION_POINTERS *pExInfo) noexcep
     eInfo.ClientPointers    = FALSE;
 
     // Get dump type using centralized mapping
-    MINIDUMP_TYPE dumpType = _getMinidumpType(s_currentConfig.getType());
+    MINIDUMP_TYPE dumpType = _getMinidumpType(ConfigStore::Reader(s_configStore)->m_config.getType());
 
     // Validate dump type flags
     if(!_isValidMinidumpType(dumpType))
@@ -2992,9 +8809,10 @@ void
 CoreDumpGenerator::_setupSignalHandlers()
 {
   struct sigaction sa;
-  sa.sa_handler = _unixSignalHandler;
+  std::memset(&sa, 0, sizeof(sa));
+  sa.sa_sigaction = _unixCrashHandler; // Receives the faulting context for the crash dump
   sigemptyset(&sa.sa_mask);
-  sa.sa_flags = SA_RESETHAND; // This flag resets handler after first call
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESETHAND; // Reset after first call; run on the alternate stack
 
   sigaction(SIGSEGV, &sa, nullptr);
   sigaction(SIGABRT, &sa, nullptr);
@@ -3013,10 +8831,85 @@ CoreDumpGenerator::_setupCoreDumpSettings()
   core_limit.rlim_cur = RLIM_INFINITY;
   core_limit.rlim_max = RLIM_INFINITY;
   setrlimit(RLIMIT_CORE, &core_limit);
+  _setupCoreDumpFilter();
 
   _logMessage("UNIX core dump settings configured", false);
 }
 
+void
+CoreDumpGenerator::_setupCoreDumpFilter()
+{
+  ConfigStore::Reader const active(s_configStore);
+  if(!active->m_config.hasKernelDumpFilter()) return;
+  std::uint32_t const mask = static_cast<std::uint32_t>(KernelDumpFilter::ALL);
+  std::uint32_t current    = 0;
+  if(!_readCoreDumpFilter(current))
+  {
+    _logMessage("WARNING: Cannot read /proc/self/coredump_filter: " + std::string(std::strerror(errno)), true);
+    return;
+  }
+
+  // Bits outside KernelDumpFilter (e.g. DAX) keep their current value
+  std::uint32_t const requested
+    = (current & ~mask) | static_cast<std::uint32_t>(active->m_config.getKernelDumpFilter());
+
+  // Read back: the write may be refused, and kernels drop bits they do not support
+  auto const hex = [](std::uint32_t value)
+  {
+    char text[16];
+    std::snprintf(text, sizeof(text), "0x%02x", static_cast<unsigned>(value));
+    return std::string(text);
+  };
+  std::string const failure = "WARNING: Failed to set kernel coredump_filter to " + hex(requested);
+  if(!_writeCoreDumpFilter(requested))
+  {
+    _logMessage(failure + ": " + std::string(std::strerror(errno)), true);
+    return;
+  }
+  std::uint32_t verified = 0;
+  if(!_readCoreDumpFilter(verified))
+  {
+    _logMessage(failure + ": cannot read it back: " + std::string(std::strerror(errno)), true);
+    return;
+  }
+  if((verified & mask) != (requested & mask))
+  {
+    _logMessage(failure + " (is " + hex(verified) + ")", true);
+    return;
+  }
+  _logMessage("Kernel coredump_filter set to " + hex(requested) + " (was " + hex(current) + ")", false);
+}
+
+bool
+CoreDumpGenerator::_readCoreDumpFilter(std::uint32_t &filter) noexcept
+{
+  int fd = open("/proc/self/coredump_filter", O_RDONLY | O_CLOEXEC);
+  if(fd < 0) return false;
+  char text[32]     = {};
+  ssize_t bytesRead = 0;
+  while((bytesRead = read(fd, text, sizeof(text) - 1)) < 0 && errno == EINTR) {}
+  int const readErrno = bytesRead < 0 ? errno : EIO; // An empty read sets no errno
+  close(fd);
+  errno = readErrno;
+  if(bytesRead <= 0) return false;
+  filter = static_cast<std::uint32_t>(std::strtoul(text, nullptr, 16));
+  return true;
+}
+
+bool
+CoreDumpGenerator::_writeCoreDumpFilter(std::uint32_t filter) noexcept
+{
+  int fd = open("/proc/self/coredump_filter", O_WRONLY | O_CLOEXEC);
+  if(fd < 0) return false;
+  char text[16];
+  int const length           = std::snprintf(text, sizeof(text), "0x%x", static_cast<unsigned>(filter));
+  ssize_t const bytesWritten = write(fd, text, static_cast<size_t>(length));
+  int const writeErrno       = bytesWritten < 0 ? errno : EIO; // A short write sets no errno
+  close(fd);
+  errno = writeErrno;
+  return bytesWritten == length;
+}
+
 void
 CoreDumpGenerator::_setupCorePattern()
 {
@@ -3026,72 +8919,362 @@ CoreDumpGenerator::_setupCorePattern()
     _logMessage("Current core pattern: " + s_originalCorePattern, false);
 }
 
-void
-CoreDumpGenerator::_createManualCoreDump()
+bool
+CoreDumpGenerator::_createUnixDump(std::string const &filename, DumpConfiguration const &config)
+{
+  if(config.getType() == DumpType::CORE_DUMP_COMPRESSED && !config.isCompress())
+  {
+    DumpConfiguration compressed = config;
+    compressed.setCompress(true);
+    return _createUnixDump(filename, compressed);
+  }
+
+  std::string outputFilename = filename;
+  if(config.isCompress())
+  {
+    if(CoreDumpEngine::isCompressionAvailable(config.getCompressionCodec()))
+      outputFilename += CoreDumpEngine::compressionExtension(config.getCompressionCodec());
+    else
+      _logMessage("WARNING: Requested compression codec is not compiled in, writing uncompressed core", true);
+  }
+
+  switch(config.getType())
+  {
+    case DumpType::CORE_DUMP_STACK_ONLY:
+      // Micro-dump: a few hundred KB are written faster than fork() returns
+      return _createManualCoreDump(outputFilename, config);
+    case DumpType::CORE_DUMP_FULL:
+    case DumpType::CORE_DUMP_STACKS_AND_DATA:
+    case DumpType::CORE_DUMP_HEAP_FILTERED:
+    case DumpType::CORE_DUMP_COMPRESSED:
+      return config.isSnapshot() ? _createSnapshotCoreDump(outputFilename, config)
+                                 : _createManualCoreDump(outputFilename, config);
+    default:
+      _logMessage("Unsupported UNIX dump type: " + dumpTypeToString(config.getType()), true);
+      return false;
+  }
+}
+
+bool
+CoreDumpGenerator::_createManualCoreDump(std::string const &filename, DumpConfiguration const &config) noexcept
 {
   try
   {
-    // Generate filename
-    std::string timeStr = formatTime("%d.%m.%Y.%H.%M.%S");
-    std::ostringstream filename;
-    filename << s_dumpDirectory << "/manual_core_" << timeStr << ".core";
+    // Capture the requesting thread first so its registers describe this frame
+    ucontext_t context;
+    if(getcontext(&context) != 0)
+    {
+      _logMessage("getcontext() failed: " + std::string(std::strerror(errno)), true);
+      return false;
+    }
+
+    CoreDumpEngine::ThreadList threads(1);
+    CoreDumpEngine::fillThreadState(threads.front(), CoreDumpEngine::currentThreadId(), context);
+    CoreDumpEngine::AddressList stackPointers; // Threads that did not report registers
+    if(config.isSampleThreadRegisters())
+      CoreDumpEngine::captureThreadStates(threads, stackPointers);
+    else
+      CoreDumpEngine::readThreadStackPointers(getpid(), CoreDumpEngine::currentThreadId(), stackPointers);
+
+    MemoryFilter scratchFilter;
+    CoreDumpEngine::MemoryMap memoryMap;
+    bool loaded = false;
+    {
+      // The active filter is only needed while the map is read
+      ConfigStore::Reader const active(s_configStore);
+      loaded = memoryMap.load(getpid(), &_resolveMemoryFilter(config, *active, scratchFilter));
+    }
+    if(!loaded)
+    {
+      _logMessage("Failed to read /proc/self/maps: " + std::string(std::strerror(errno)), true);
+      return false;
+    }
 
-    // Sanitize filename
-    std::string sanitizedFilename = filename.str();
-    std::replace(sanitizedFilename.begin(), sanitizedFilename.end(), ':', '_');
-    std::replace(sanitizedFilename.begin(), sanitizedFilename.end(), ' ', '_');
+    // Apply the dump tier, then trim to the size budget: stacks first, then module data,
+    // register-referenced heap, the rest
+    std::unique_ptr<CoreDumpEngine::CaptureEngine> const captureEngine =
+      CoreDumpEngine::createCaptureEngine(config.getType());
+    CoreDumpEngine::BudgetPlan budgetPlan;
+    bool const budgeted = config.getMaxSizeBytes() > 0;
+    captureEngine->select(memoryMap, threads, stackPointers);
+    CoreDumpEngine::ArenaVector<CoreDumpEngine::ExcludedRegion> excluded;
+    CoreDumpEngine::ExclusionRegistry::instance().snapshot(excluded);
+    CoreDumpEngine::excludeRegions(memoryMap, excluded);
+    if(budgeted)
+      CoreDumpEngine::planSizeBudget(memoryMap, threads, stackPointers, config.getMaxSizeBytes(), budgetPlan);
+
+    int fd = open(filename.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_CLOEXEC, 0640);
+    if(fd < 0)
+    {
+      _logMessage("Failed to create core file " + filename + ": " + std::string(std::strerror(errno)), true);
+      return false;
+    }
 
-    // Try to use gcore if available
-    std::string gcore_cmd = "which gcore >/dev/null 2>&1";
-    int gcore_available   = system(gcore_cmd.c_str());
+    OperationGuards guards;
+    size_t const workerCount = _reserveOperationSlots(guards, config.isCompress());
+    std::unique_ptr<CoreDumpEngine::OutputSink> sink = CoreDumpEngine::createOutputSink(
+      fd, config.isCompress(), config.getCompressionCodec(), config.getCompressionLevel(), workerCount,
+      config.isSparse());
+    if(!sink)
+    {
+      _logMessage("Failed to initialize core compressor", true);
+      close(fd);
+      unlink(filename.c_str());
+      return false;
+    }
 
-    if(gcore_available == 0)
+    CoreDumpEngine::CoreDumpStatistics stats;
+    CoreDumpEngine::ElfCoreWriter writer(*sink, getpid());
+    writer.setReadAhead(true);
+    writer.setSkipNonResident(config.isSkipNonResident());
+    if(budgeted)
+      writer.addNote(CoreDumpEngine::Constants::NOTE_NAME_CDGEN, CoreDumpEngine::Constants::NT_CDGEN_DROPPED_REGIONS,
+                     CoreDumpEngine::encodeDroppedRegions(budgetPlan));
+    if(!excluded.empty())
+      writer.addNote(CoreDumpEngine::Constants::NOTE_NAME_CDGEN, CoreDumpEngine::Constants::NT_CDGEN_EXCLUDED_REGIONS,
+                     CoreDumpEngine::encodeExcludedRegions(excluded));
+    bool const written   = writer.write(memoryMap, threads, stats);
+    int const writeErrno = errno;
+    bool const closed    = (close(fd) == 0);
+
+    if(!written || !closed)
     {
-      // Use gcore to create core dump
-      std::string gcore_exec = "gcore -o " + sanitizedFilename + " " + std::to_string(getpid()) + " >/dev/null 2>&1";
-      int result             = system(gcore_exec.c_str());
+      _logMessage("Failed to write core file " + filename + ": " + std::string(std::strerror(writeErrno)), true);
+      unlink(filename.c_str());
+      return false;
+    }
 
-      if(result == 0)
-      {
-        _logMessage("Manual core dump created using gcore: " + sanitizedFilename, false);
+    _logMessage("Native core written: " + std::to_string(stats.m_segmentCount) + " segments ("
+                  + std::to_string(stats.m_capturedSegments) + " captured), "
+                  + std::to_string(stats.m_memoryBytes / MB_1) + " MB of memory",
+                false);
+    if(stats.m_unreadableBytes > 0)
+      _logMessage("Zero-filled " + std::to_string(stats.m_unreadableBytes) + " unreadable bytes", false);
+    if(stats.m_nonResidentBytes > 0)
+      _logMessage("Skipped " + std::to_string(stats.m_nonResidentBytes / MB_1) + " MB of non-resident pages", false);
+    if(stats.m_holeBytes > 0)
+      _logMessage("Left " + std::to_string(stats.m_holeBytes / MB_1) + " MB of zero pages as file holes", false);
+    if(budgetPlan.m_droppedBytes > 0)
+      _logMessage("Size budget of " + std::to_string(config.getMaxSizeBytes() / MB_1) + " MB: dropped "
+                    + std::to_string(budgetPlan.m_droppedBytes / MB_1) + " MB in "
+                    + std::to_string(budgetPlan.m_dropped.size()) + " ranges (see CDGEN note)",
+                  false);
 
-        // Check if file was created and get size
-        struct stat fileStat;
-        if(stat(sanitizedFilename.c_str(), &fileStat) == 0)
-          _logMessage("Core dump size: " + std::to_string(fileStat.st_size) + " bytes", false);
-      }
-      else { _logMessage("Failed to create core dump using gcore", true); }
+    _logDumpCreationSuccess(filename, static_cast<size_t>(stats.m_fileSize), config.getType());
+    _logCoreDumpSize(filename, stats.m_fileSize);
+    return true;
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to create manual core dump: " + std::string(exc.what()), true);
+    return false;
+  }
+}
+
+MemoryFilter const &
+CoreDumpGenerator::_resolveMemoryFilter(DumpConfiguration const &config, ConfigSnapshot const &active,
+                                        MemoryFilter &scratch) noexcept
+{
+  if(config.getMemoryFilters() == active.m_config.getMemoryFilters()) return active.m_memoryFilter;
+  if(!scratch.compile(config.getMemoryFilters()))
+    _logMessage("WARNING: Invalid memory filter ignored, capturing all regions", true);
+  return scratch;
+}
+
+bool
+CoreDumpGenerator::_createSnapshotCoreDump(std::string const &filename, DumpConfiguration const &config) noexcept
+{
+  try
+  {
+    // After fork() only the calling thread exists and locks held by other threads stay locked, so thread states,
+    // filter, capture engine and output file are prepared here. The child still allocates (MemoryMap::load(),
+    // region selection, note encoding) and starts the compression threads of its output sink. POSIX only allows
+    // async-signal-safe calls there; this relies on glibc resetting its malloc locks in fork(), and on the
+    // child touching no other library state (no logging, no configuration, no operation slots)
+    ucontext_t context;
+    if(getcontext(&context) != 0)
+    {
+      _logMessage("getcontext() failed: " + std::string(std::strerror(errno)), true);
+      return false;
     }
+
+    CoreDumpEngine::ThreadList threads(1);
+    CoreDumpEngine::fillThreadState(threads.front(), CoreDumpEngine::currentThreadId(), context);
+    CoreDumpEngine::ProcessIdentity const identity = CoreDumpEngine::ProcessIdentity::current();
+    MemoryFilter scratchFilter;
+    // Released in the parent right after fork(); the child keeps its own copy of the snapshot
+    std::unique_ptr<ConfigStore::Reader> active(new ConfigStore::Reader(s_configStore));
+    MemoryFilter const &memoryFilter = _resolveMemoryFilter(config, **active, scratchFilter);
+
+    // The child only sees its own thread, so the other threads are sampled here
+    CoreDumpEngine::AddressList stackPointers;
+    if(config.isSampleThreadRegisters())
+      CoreDumpEngine::captureThreadStates(threads, stackPointers);
     else
+      CoreDumpEngine::readThreadStackPointers(getpid(), CoreDumpEngine::currentThreadId(), stackPointers);
+    std::unique_ptr<CoreDumpEngine::CaptureEngine> const captureEngine =
+      CoreDumpEngine::createCaptureEngine(config.getType());
+    std::uint64_t const budget = config.getMaxSizeBytes();
+
+    // Only the dump's own slot stays reserved until the reaper has collected the child, and it is never waited
+    // for: the caller must not block behind earlier snapshot children. The compression workers run in the niced
+    // child and hold no slots of this process
+    std::shared_ptr<OperationGuards> guards(new OperationGuards());
+    guards->emplace_back(new OperationGuard(std::try_to_lock));
+    if(!guards->front()->isAcquired())
+    {
+      _logMessage("Snapshot dump refused: " + std::to_string(MAX_CONCURRENT_OPERATIONS) + " dumps are in progress",
+                  true);
+      return false;
+    }
+    size_t const hardwareThreads = std::thread::hardware_concurrency();
+    size_t const maxOperations   = MAX_CONCURRENT_OPERATIONS; // Copy: std::min binds by reference
+    size_t const workerCount
+      = config.isCompress() && hardwareThreads > 1 ? std::min(hardwareThreads, maxOperations) : 0;
+
+    std::string const partialFilename = filename + ".partial";
+    int fd = open(partialFilename.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_CLOEXEC, 0640);
+    if(fd < 0)
     {
-      // Try to use gdb if available
-      std::string gdb_cmd = "which gdb >/dev/null 2>&1";
-      int gdb_available   = system(gdb_cmd.c_str());
+      _logMessage("Failed to create core file " + partialFilename + ": " + std::string(std::strerror(errno)), true);
+      return false;
+    }
 
-      if(gdb_available == 0)
-      {
-        // Use gdb to create core dump
-        std::string gdb_exec = "gdb --batch --quiet -ex 'generate-core-file " + sanitizedFilename + "' -ex 'quit' -p "
-                               + std::to_string(getpid()) + " >/dev/null 2>&1";
-        int result = system(gdb_exec.c_str());
+    // The child reports its CoreDumpStatistics through this pipe before exiting
+    int statsPipe[2] = {-1, -1};
+    if(pipe2(statsPipe, O_CLOEXEC) != 0) statsPipe[0] = statsPipe[1] = -1;
 
-        if(result == 0)
-        {
-          _logMessage("Manual core dump created using gdb: " + sanitizedFilename, false);
+    std::shared_ptr<PerformanceMetrics> metrics(new PerformanceMetrics());
+    _startPerformanceMonitoring(*metrics);
+    metrics->m_snapshot = true;
 
-          // Check if file was created and get size
-          struct stat fileStat;
-          if(stat(sanitizedFilename.c_str(), &fileStat) == 0)
-            _logMessage("Core dump size: " + std::to_string(fileStat.st_size) + " bytes", false);
+    auto const forkStart = std::chrono::high_resolution_clock::now();
+    pid_t const child    = fork();
+    metrics->m_forkPause = std::chrono::high_resolution_clock::now() - forkStart;
+
+    if(child == 0)
+    {
+      // Snapshot child: never log, never return into the caller's code
+      bool written = false;
+      CoreDumpEngine::CoreDumpStatistics stats;
+      if(statsPipe[0] >= 0) close(statsPipe[0]);
+      try
+      {
+        // Best effort: yield the CPU to the parent that keeps serving
+        setpriority(PRIO_PROCESS, 0, getpriority(PRIO_PROCESS, 0) + SNAPSHOT_NICE_INCREMENT);
+
+        CoreDumpEngine::MemoryMap memoryMap;
+        std::unique_ptr<CoreDumpEngine::OutputSink> sink = CoreDumpEngine::createOutputSink(
+          fd, config.isCompress(), config.getCompressionCodec(), config.getCompressionLevel(), workerCount,
+          config.isSparse());
+        if(sink && memoryMap.load(getpid(), &memoryFilter))
+        {
+          CoreDumpEngine::BudgetPlan budgetPlan;
+          CoreDumpEngine::ElfCoreWriter writer(*sink, getpid());
+          writer.setIdentity(identity);
+          writer.setReadAhead(true);
+          writer.setSkipNonResident(config.isSkipNonResident());
+          captureEngine->select(memoryMap, threads, stackPointers);
+          CoreDumpEngine::ArenaVector<CoreDumpEngine::ExcludedRegion> excluded;
+          CoreDumpEngine::ExclusionRegistry::instance().snapshot(excluded);
+          CoreDumpEngine::excludeRegions(memoryMap, excluded);
+          if(!excluded.empty())
+            writer.addNote(CoreDumpEngine::Constants::NOTE_NAME_CDGEN,
+                           CoreDumpEngine::Constants::NT_CDGEN_EXCLUDED_REGIONS,
+                           CoreDumpEngine::encodeExcludedRegions(excluded));
+          if(budget > 0)
+          {
+            CoreDumpEngine::planSizeBudget(memoryMap, threads, stackPointers, budget, budgetPlan);
+            writer.addNote(CoreDumpEngine::Constants::NOTE_NAME_CDGEN,
+                           CoreDumpEngine::Constants::NT_CDGEN_DROPPED_REGIONS,
+                           CoreDumpEngine::encodeDroppedRegions(budgetPlan));
+          }
+          written              = writer.write(memoryMap, threads, stats);
+          stats.m_droppedBytes = budgetPlan.m_droppedBytes;
         }
-        else { _logMessage("Failed to create core dump using gdb", true); }
       }
-      else { _logMessage("Neither gcore nor gdb available for manual core dump creation", true); }
+      catch(...)
+      {
+        written = false;
+      }
+
+      written = (close(fd) == 0) && written && rename(partialFilename.c_str(), filename.c_str()) == 0;
+      if(!written) unlink(partialFilename.c_str());
+      if(written && statsPipe[1] >= 0)
+      {
+        ssize_t const reported = write(statsPipe[1], &stats, sizeof(stats));
+        (void)reported; // Atomic (below PIPE_BUF); a missing report makes the parent count the dump as failed
+      }
+      _exit(written ? 0 : 1);
+    }
+
+    int const forkErrno = errno;
+    active.reset();
+    close(fd);
+    if(statsPipe[1] >= 0) close(statsPipe[1]);
+    if(child < 0)
+    {
+      _logMessage("fork() failed for snapshot dump: " + std::string(std::strerror(forkErrno)), true);
+      if(statsPipe[0] >= 0) close(statsPipe[0]);
+      unlink(partialFilename.c_str());
+      return false;
     }
+
+    auto const pause = std::chrono::duration_cast<std::chrono::microseconds>(metrics->m_forkPause);
+    _logMessage("Snapshot process " + std::to_string(child) + " started (fork pause: " + std::to_string(pause.count())
+                  + "us)",
+                false);
+
+    DumpType const dumpType = config.getType();
+    int const statsFd       = statsPipe[0];
+    std::thread(
+      [child, filename, dumpType, metrics, statsFd, guards]()
+      {
+        CoreDumpEngine::CoreDumpStatistics stats;
+        bool haveStats = false;
+        if(statsFd >= 0)
+        {
+          ssize_t bytesRead = 0;
+          while((bytesRead = read(statsFd, &stats, sizeof(stats))) < 0 && errno == EINTR) {}
+          haveStats = (bytesRead == static_cast<ssize_t>(sizeof(stats)));
+          close(statsFd);
+        }
+
+        int status   = 0;
+        pid_t reaped = -1;
+        while((reaped = waitpid(child, &status, 0)) < 0 && errno == EINTR) {}
+
+        // The child reports only after the rename; status is only known when waitpid() succeeded (it fails
+        // with ECHILD once the application ignores SIGCHLD or reaps every child itself)
+        bool const exited  = reaped == child && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        bool const success = statsFd >= 0 ? haveStats : exited;
+        struct stat fileStat;
+        if(success && stat(filename.c_str(), &fileStat) == 0) metrics->m_dumpSize = static_cast<size_t>(fileStat.st_size);
+
+        if(success)
+        {
+          if(haveStats && stats.m_droppedBytes > 0)
+            _logMessage("Size budget: dropped " + std::to_string(stats.m_droppedBytes / MB_1)
+                          + " MB of memory (see CDGEN note)",
+                        false);
+          if(haveStats && stats.m_nonResidentBytes > 0)
+            _logMessage("Skipped " + std::to_string(stats.m_nonResidentBytes / MB_1) + " MB of non-resident pages",
+                        false);
+          _logDumpCreationSuccess(filename, metrics->m_dumpSize, dumpType);
+          _logCoreDumpSize(filename, haveStats ? stats.m_fileSize : 0);
+        }
+        else
+          _logMessage("Snapshot process " + std::to_string(child) + " failed to write " + filename, true);
+        _endPerformanceMonitoring(*metrics, success);
+      })
+      .detach();
+
+    return true;
   }
   catch(std::exception const &exc)
   {
-    _logMessage("Failed to create manual core dump: " + std::string(exc.what()), true);
+    _logMessage("Failed to create snapshot core dump: " + std::string(exc.what()), true);
+    return false;
   }
 }
 
@@ -3120,26 +9303,51 @@ CoreDumpGenerator::_restoreCorePattern()
   }
 }
 
+void
+CoreDumpGenerator::_stopSystemdMonitor() noexcept
+{
+  s_monitorThreadShouldStop.store(true, std::memory_order_release);
+  if(s_monitorWakeFd >= 0)
+  {
+    std::uint64_t const one = 1;
+    ssize_t const written   = write(s_monitorWakeFd, &one, sizeof(one));
+    (void)written;
+  }
+  if(s_monitorThread.joinable()) s_monitorThread.join();
+  if(s_monitorWakeFd >= 0)
+  {
+    close(s_monitorWakeFd);
+    s_monitorWakeFd = -1;
+  }
+}
+
 void
 CoreDumpGenerator::_instantSystemdMonitor() noexcept
 {
   // INSTANT core dump extraction using Linux inotify API
-  // Source: inotify(7) man page - official Linux kernel documentation
-  // Monitors /var/lib/systemd/coredump/ for new files and extracts IMMEDIATELY (< 1 sec)
+  // Source: inotify(7) and epoll(7) man pages - official Linux kernel documentation
+  // Monitors /var/lib/systemd/coredump/ for finished files and extracts them on a small worker pool
 
   try
   {
-    char const *systemd_coredump_dir = "/var/lib/systemd/coredump";
+    // Read once and release the Reader: it would keep every later replaced configuration allocated
+    std::string systemd_coredump_dir;
+    bool decompress = true;
+    {
+      ConfigStore::Reader const active(s_configStore);
+      systemd_coredump_dir = active->m_config.getSystemdCoredumpDirectory();
+      decompress           = active->m_config.isDecompressSystemdCores();
+    }
 
     // Check if systemd-coredump directory exists and accessible
     struct stat st;
-    if(stat(systemd_coredump_dir, &st) != 0)
+    if(stat(systemd_coredump_dir.c_str(), &st) != 0)
     {
       _logMessage("systemd-coredump directory not accessible - skipping instant monitor", false);
       return;
     }
 
-    // Initialize inotify (non-blocking mode)
+    // Initialize inotify (non-blocking mode, drained after every epoll wakeup)
     int inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
     if(inotify_fd < 0)
     {
@@ -3147,8 +9355,11 @@ CoreDumpGenerator::_instantSystemdMonitor() noexcept
       return;
     }
 
-    // Watch for new files (IN_CREATE) and moved files (IN_MOVED_TO)
-    int watch_fd = inotify_add_watch(inotify_fd, systemd_coredump_dir, IN_CREATE | IN_MOVED_TO);
+    // systemd-coredump writes an O_TMPFILE and linkat()s it in place, so the final name first shows up in IN_CREATE
+    // (its IN_CLOSE_WRITE carries a "#<inode>" name); IN_CLOSE_WRITE and IN_MOVED_TO cover files written in place
+    // or renamed from a temporary name, so no delay is needed before extraction
+    std::uint32_t const watch_mask = IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO;
+    int watch_fd                   = inotify_add_watch(inotify_fd, systemd_coredump_dir.c_str(), watch_mask);
     if(watch_fd < 0)
     {
       close(inotify_fd);
@@ -3156,148 +9367,248 @@ CoreDumpGenerator::_instantSystemdMonitor() noexcept
       return;
     }
 
-    _logMessage("INSTANT systemd-coredump monitor ACTIVE (inotify-based)", false);
-    _logMessage("   - Monitoring: " + std::string(systemd_coredump_dir), false);
-    _logMessage("   - Will extract dumps IMMEDIATELY upon creation (<1 sec)", false);
+    // Block on both the watch and the shutdown eventfd without a timeout: no wakeups while idle
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    struct epoll_event watch_event;
+    std::memset(&watch_event, 0, sizeof(watch_event));
+    watch_event.events  = EPOLLIN;
+    watch_event.data.fd = inotify_fd;
+    struct epoll_event wake_event;
+    std::memset(&wake_event, 0, sizeof(wake_event));
+    wake_event.events  = EPOLLIN;
+    wake_event.data.fd = s_monitorWakeFd;
+    if(epoll_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, inotify_fd, &watch_event) != 0
+       || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, s_monitorWakeFd, &wake_event) != 0)
+    {
+      _logMessage("Failed to set up epoll for systemd monitor: " + std::string(strerror(errno)), true);
+      if(epoll_fd >= 0) close(epoll_fd);
+      inotify_rm_watch(inotify_fd, watch_fd);
+      close(inotify_fd);
+      return;
+    }
+
+    // Auto-detect executable name from /proc/self/exe (UNIVERSAL)
+    std::string exe_name = "unknown"; // Fallback if readlink fails
+    char exe_path[PATH_MAX];
+    ssize_t exe_len = readlink("/proc/self/exe", exe_path, sizeof(exe_path) - 1);
+    if(exe_len != -1)
+    {
+      exe_path[exe_len] = '\0';
+      char const *base  = strrchr(exe_path, '/');
+      exe_name          = base ? (base + 1) : exe_path;
+    }
+    // Format: core.<exe_name>.{uid}.{boot-id}.{pid}.{timestamp}[.zst]
+    std::string const core_prefix = "core." + exe_name;
+
+    _logMessage("INSTANT systemd-coredump monitor ACTIVE (inotify + epoll)", false);
+    _logMessage("   - Monitoring: " + systemd_coredump_dir, false);
+    _logMessage("   - Will extract dumps as soon as systemd-coredump finishes writing them", false);
     _logMessage("   - Target directory: " + s_dumpDirectory, false);
 
-    // Event buffer (aligned for inotify_event structure)
-    char event_buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    // Extraction pool: workers are started on demand, so an idle monitor holds no threads besides itself
+    std::deque<std::string> pending;
+    std::mutex pending_mutex;
+    std::condition_variable pending_changed;
+    std::vector<std::thread> workers;
+    size_t idle_workers  = 0;
+    bool workers_stopped = false;
+    auto const worker    = [&]() {
+      std::unique_lock<std::mutex> lock(pending_mutex);
+      for(;;)
+      {
+        ++idle_workers;
+        pending_changed.wait(lock, [&]() { return workers_stopped || !pending.empty(); });
+        --idle_workers;
+        if(pending.empty()) return;
+        std::string file_name = std::move(pending.front());
+        pending.pop_front();
+        lock.unlock();
+        _extractSystemdCoreDump(systemd_coredump_dir, file_name, decompress);
+        lock.lock();
+      }
+    };
 
-    while(!s_monitorThreadShouldStop.load(std::memory_order_acquire))
-    {
-      // Use select() for timeout support (allows clean shutdown)
-      fd_set readfds;
-      FD_ZERO(&readfds);
-      FD_SET(inotify_fd, &readfds);
+    // Names already queued: a linked core is reported again when it is closed or renamed
+    std::deque<std::string> recent;
 
-      struct timeval timeout;
-      timeout.tv_sec  = 1; // 1 second timeout
-      timeout.tv_usec = 0;
+    // Event buffer (aligned for inotify_event structure)
+    char event_buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
 
-      int select_ret  = select(inotify_fd + 1, &readfds, nullptr, nullptr, &timeout);
+    // Finish what was already detected, then release everything; also run when the event loop throws
+    auto const shutdown = [&]() {
+      {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        workers_stopped = true;
+      }
+      pending_changed.notify_all();
+      for(auto &thread : workers) thread.join();
+      close(epoll_fd);
+      inotify_rm_watch(inotify_fd, watch_fd);
+      close(inotify_fd);
+    };
 
-      if(select_ret > 0 && FD_ISSET(inotify_fd, &readfds))
+    try
+    {
+      while(!s_monitorThreadShouldStop.load(std::memory_order_acquire))
       {
-        // Read inotify events
-        ssize_t len = read(inotify_fd, event_buffer, sizeof(event_buffer));
+        struct epoll_event ready[2];
+        int const ready_count = epoll_wait(epoll_fd, ready, 2, -1);
+        if(ready_count < 0)
+        {
+          if(errno == EINTR) continue;
+          _logMessage("epoll_wait() error in systemd monitor: " + std::string(strerror(errno)), true);
+          break;
+        }
 
-        if(len > 0)
+        // Drain every queued event; the watch is level-triggered, so anything left would wake us again
+        for(;;)
         {
-          // Process all events in buffer
+          ssize_t len = read(inotify_fd, event_buffer, sizeof(event_buffer));
+          if(len < 0)
+          {
+            if(errno == EINTR) continue;
+            if(errno != EAGAIN) _logMessage("inotify read error: " + std::string(strerror(errno)), true);
+            break;
+          }
+
           const struct inotify_event *event;
           for(char *ptr = event_buffer; ptr < event_buffer + len; ptr += sizeof(struct inotify_event) + event->len)
           {
             event = reinterpret_cast<const struct inotify_event *>(ptr);
-
-            // Check if this is a new file creation or move
-            if((event->mask & (IN_CREATE | IN_MOVED_TO)) && event->len > 0)
+            if(!(event->mask & watch_mask) || (event->mask & IN_ISDIR) || event->len == 0) continue;
+
+            // Filter for our application's finished core dumps only (".#core..." and "#<inode>" are systemd
+            // temporaries)
+            std::string filename = event->name;
+            if(filename.compare(0, 2, ".#") == 0 || filename.compare(0, 1, "#") == 0
+               || filename.find(core_prefix) == std::string::npos
+               || std::find(recent.begin(), recent.end(), filename) != recent.end())
+              continue;
+            // A linked O_TMPFILE arrives with its contents; an empty file is still being written in place and is
+            // picked up by its IN_CLOSE_WRITE instead
+            struct stat created;
+            if((event->mask & IN_CREATE)
+               && (stat((systemd_coredump_dir + "/" + filename).c_str(), &created) != 0 || created.st_size == 0))
+              continue;
+            recent.push_back(filename);
+            if(recent.size() > CoreDumpEngine::Constants::SYSTEMD_RECENT_CORES) recent.pop_front();
+
+            _logMessage("NEW CORE DUMP DETECTED: " + filename, false);
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            pending.push_back(std::move(filename));
+            if(idle_workers < pending.size() && workers.size() < CoreDumpEngine::Constants::SYSTEMD_EXTRACTION_WORKERS)
             {
-              std::string filename = event->name;
-
-              // Auto-detect executable name from /proc/self/exe (UNIVERSAL)
-              static std::string exe_name;
-              if(exe_name.empty())
+              try
               {
-                char buf[PATH_MAX];
-                ssize_t exe_len = readlink("/proc/self/exe", buf, sizeof(buf) - 1);
-                if(exe_len != -1)
-                {
-                  buf[exe_len]     = '\0';
-                  char const *base = strrchr(buf, '/');
-                  exe_name         = base ? (base + 1) : buf;
-                }
-                else
-                {
-                  exe_name = "unknown"; // Fallback if readlink fails
-                }
+                workers.emplace_back(worker);
               }
-
-              // Filter for our application's core dumps only
-              // Format: core.<exe_name>.{uid}.{boot-id}.{pid}.{timestamp}.zst
-              std::string core_prefix = "core." + exe_name;
-              if(filename.find(core_prefix) != std::string::npos)
+              catch(std::system_error const &exc)
               {
-                _logMessage("NEW CORE DUMP DETECTED: " + filename, false);
-
-                // Give systemd-coredump time to finish writing and compressing
-                std::this_thread::sleep_for(std::chrono::milliseconds(500));
-
-                // Generate target filename with timestamp
-                std::string timeStr     = formatTime("%d.%m.%Y.%H.%M.%S");
-                std::string target_file = s_dumpDirectory + "/core_dump_full_" + timeStr + ".core";
-
-                // Extract using coredumpctl (works without sudo if user in systemd-journal group)
-                // Use auto-detected executable name for universal compatibility
-                std::string extract_cmd = "coredumpctl dump " + exe_name + " --output=\"" + target_file + "\" 2>&1";
-
-                _logMessage("EXTRACTING IMMEDIATELY to: " + target_file, false);
-
-                FILE *pipe = popen(extract_cmd.c_str(), "r");
-                if(pipe)
-                {
-                  char cmd_buffer[512];
-                  std::string cmd_output;
-                  while(fgets(cmd_buffer, sizeof(cmd_buffer), pipe)) cmd_output += cmd_buffer;
-
-                  int exit_code = pclose(pipe);
-                  if(exit_code == 0)
-                  {
-                    // Verify extraction success
-                    struct stat dump_stat;
-                    if(stat(target_file.c_str(), &dump_stat) == 0)
-                    {
-                      double size_mb = static_cast<double>(dump_stat.st_size) / (1024.0 * 1024.0);
-                      _logMessage("SUCCESS: Core dump extracted INSTANTLY!", false);
-                      _logMessage("   File: " + target_file, false);
-                      _logMessage("   Size: " + std::to_string(size_mb) + " MB (" + std::to_string(dump_stat.st_size)
-                                    + " bytes)",
-                                  false);
-                      _logMessage("   Extraction time: <1 second after crash", false);
-
-                      // Set proper permissions (readable by user and admin group)
-                      chmod(target_file.c_str(), 0640);
-                    }
-                    else { _logMessage("File extracted but stat() failed", true); }
-                  }
-                  else
-                  {
-                    _logMessage("coredumpctl failed (exit code: " + std::to_string(exit_code) + ")", true);
-                    if(!cmd_output.empty()) _logMessage("   Output: " + cmd_output, true);
-                    _logMessage("   Ensure user is in 'systemd-journal' group: sudo usermod -aG systemd-journal $USER",
-                                true);
-                  }
-                }
-                else { _logMessage("Failed to execute coredumpctl command", true); }
+                // The file stays queued for the workers that are running, or for the next successful start
+                _logMessage("Failed to start extraction worker: " + std::string(exc.what()), true);
               }
             }
+            pending_changed.notify_one();
           }
         }
-        else if(len < 0 && errno != EAGAIN)
+      }
+    }
+    catch(...)
+    {
+      shutdown();
+      throw;
+    }
+    shutdown();
+    _logMessage("Instant systemd monitor stopped cleanly", false);
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Exception in instant systemd monitor: " + std::string(exc.what()), true);
+  }
+  catch(...)
+  {
+    _logMessage("Unknown exception in instant systemd monitor", true);
+  }
+}
+
+void
+CoreDumpGenerator::_extractSystemdCoreDump(std::string const &directory, std::string const &fileName,
+                                           bool decompress) noexcept
+{
+  try
+  {
+    std::string pid;
+    if(!CoreDumpEngine::parseSystemdCorePid(fileName, pid))
+    {
+      _logMessage("Unrecognized systemd-coredump file name: " + fileName, true);
+      return;
+    }
+
+    // Generate target filename with timestamp; the PID keeps names unique within a burst
+    std::string timeStr     = formatTime("%d.%m.%Y.%H.%M.%S");
+    std::string target_file = s_dumpDirectory + "/core_dump_full_" + timeStr + "_" + pid + ".core";
+
+    // Native path: no process spawn and no systemd-journal group membership needed, only read access to the file
+    CoreDumpEngine::ExtractionStatistics stats;
+    if(CoreDumpEngine::extractSystemdCore(directory + "/" + fileName, target_file, decompress, stats))
+    {
+      double const size_mb = static_cast<double>(stats.m_outputBytes) / static_cast<double>(MB_1);
+      _logMessage("SUCCESS: Core dump extracted INSTANTLY!", false);
+      _logMessage("   File: " + stats.m_path, false);
+      _logMessage("   Size: " + std::to_string(size_mb) + " MB (" + std::to_string(stats.m_outputBytes) + " bytes, "
+                    + std::to_string(stats.m_holeBytes) + " in holes)",
+                  false);
+      _logMessage(std::string("   ") + (stats.m_decompressed ? "Decompressed " : "Copied ")
+                    + std::to_string(stats.m_inputBytes) + " bytes in " + std::to_string(stats.m_seconds) + " s ("
+                    + std::to_string(stats.m_seconds > 0 ? size_mb / stats.m_seconds : 0.0) + " MB/s)",
+                  false);
+      return;
+    }
+    _logMessage("Native extraction of " + fileName + " failed (" + strerror(errno) + "), trying coredumpctl", false);
+
+    // Extract using coredumpctl (works without sudo if user in systemd-journal group)
+    // Matching by PID selects exactly this crash even when several arrive at once
+    std::string extract_cmd = "coredumpctl dump " + pid + " --output=\"" + target_file + "\" 2>&1";
+
+    _logMessage("EXTRACTING IMMEDIATELY to: " + target_file, false);
+
+    FILE *pipe = popen(extract_cmd.c_str(), "r");
+    if(pipe)
+    {
+      char cmd_buffer[512];
+      std::string cmd_output;
+      while(fgets(cmd_buffer, sizeof(cmd_buffer), pipe)) cmd_output += cmd_buffer;
+
+      int exit_code = pclose(pipe);
+      if(exit_code == 0)
+      {
+        // Verify extraction success
+        struct stat dump_stat;
+        if(stat(target_file.c_str(), &dump_stat) == 0)
         {
-          _logMessage("inotify read error: " + std::string(strerror(errno)), true);
-          break;
+          double size_mb = static_cast<double>(dump_stat.st_size) / (1024.0 * 1024.0);
+          _logMessage("SUCCESS: Core dump extracted INSTANTLY!", false);
+          _logMessage("   File: " + target_file, false);
+          _logMessage("   Size: " + std::to_string(size_mb) + " MB (" + std::to_string(dump_stat.st_size) + " bytes)",
+                      false);
+
+          // Set proper permissions (readable by user and admin group)
+          chmod(target_file.c_str(), 0640);
         }
+        else { _logMessage("File extracted but stat() failed", true); }
       }
-      else if(select_ret < 0 && errno != EINTR)
+      else
       {
-        _logMessage("select() error in systemd monitor: " + std::string(strerror(errno)), true);
-        break;
+        _logMessage("coredumpctl failed (exit code: " + std::to_string(exit_code) + ")", true);
+        if(!cmd_output.empty()) _logMessage("   Output: " + cmd_output, true);
+        _logMessage("   Ensure user is in 'systemd-journal' group: sudo usermod -aG systemd-journal $USER", true);
       }
     }
-
-    // Cleanup
-    inotify_rm_watch(inotify_fd, watch_fd);
-    close(inotify_fd);
-    _logMessage("Instant systemd monitor stopped cleanly", false);
+    else { _logMessage("Failed to execute coredumpctl command", true); }
   }
   catch(std::exception const &exc)
   {
-    _logMessage("Exception in instant systemd monitor: " + std::string(exc.what()), true);
-  }
-  catch(...)
-  {
-    _logMessage("Unknown exception in instant systemd monitor", true);
+    _logMessage("Exception while extracting " + fileName + ": " + std::string(exc.what()), true);
   }
 }
 
@@ -3365,16 +9676,556 @@ CoreDumpGenerator::_monitorAndCopyCoreDumps()
 
 void
 CoreDumpGenerator::_unixSignalHandler(int signum) noexcept
+{
+  _unixCrashHandler(signum, nullptr, nullptr);
+}
+
+void
+CoreDumpGenerator::_unixCrashHandler(int signum, siginfo_t *info, void *context) noexcept
 {
   // Only async-signal-safe operations in signal handler
   char const crash_msg[] = "CRASH DETECTED\n";
   write(STDERR_FILENO, crash_msg, sizeof(crash_msg) - 1);
 
+  _writeCrashDump(signum, info, static_cast<ucontext_t const *>(context));
+
   // Set standard behavior and re-raise signal for proper termination (like in working example)
   signal(signum, SIG_DFL);
   raise(signum);
 }
 
+void
+CoreDumpGenerator::_prepareCrashPath() noexcept
+{
+  try
+  {
+    if(!CoreDumpEngine::AltStackPool::instance().reserve())
+      _logMessage("WARNING: Failed to reserve alternate signal stack pool: " + std::string(std::strerror(errno)), true);
+    if(!CoreDumpEngine::CrashArena::instance().reserve(CoreDumpEngine::Constants::CRASH_ARENA_SIZE))
+    {
+      _logMessage("WARNING: Failed to reserve crash arena, crash dumps disabled: " + std::string(std::strerror(errno)),
+                  true);
+      return;
+    }
+
+    // Room for "<signal>_<time>_<pid>_<tid>_<token>.core"
+    std::string const prefix = s_dumpDirectory + "/crash_";
+    if(prefix.size() + 96 >= sizeof(s_crashPath))
+    {
+      _logMessage("WARNING: Dump directory path too long, crash dumps disabled", true);
+      return;
+    }
+
+    std::string const token = _generateSecureRandomComponent();
+    size_t const tokenSize  = std::min(token.size(), sizeof(s_crashToken) - 1);
+    std::memcpy(s_crashToken, token.data(), tokenSize);
+    s_crashToken[tokenSize] = '\0';
+
+    std::memcpy(s_crashPath, prefix.data(), prefix.size());
+    s_crashPrefixLength = prefix.size();
+
+    // Run lazy initializers now so the crash path never enters their guards
+    CoreDumpEngine::isZeroMemory(s_crashToken, sizeof(s_crashToken));
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to prepare crash path: " + std::string(exc.what()), true);
+  }
+}
+
+bool
+CoreDumpGenerator::_writeCrashDump(int signum, siginfo_t const *info, ucontext_t const *context) noexcept
+{
+  // One dump per process: a crash inside this function gives up, other crashing threads
+  // wait for the first one to terminate the process
+  pid_t const self = CoreDumpEngine::currentThreadId();
+  pid_t owner      = 0;
+  if(!s_crashThread.compare_exchange_strong(owner, self))
+  {
+    if(owner != self)
+      for(;;) pause();
+    return false;
+  }
+  if(s_crashPrefixLength == 0) return false;
+
+  sigjmp_buf recovery;
+  CoreDumpEngine::ArenaScope arena(recovery); // Outlives every container below
+  if(!arena.isAcquired()) return false;
+
+  // Arena allocations do not throw: when the arena and its mmap() fallback are exhausted they resume here
+  if(sigsetjmp(recovery, 0) != 0)
+  {
+    char const message[] = "Crash dump abandoned: out of memory\n";
+    write(STDERR_FILENO, message, sizeof(message) - 1);
+    return false;
+  }
+
+  ucontext_t localContext;
+  if(context == nullptr)
+  {
+    if(getcontext(&localContext) != 0) return false;
+    context = &localContext;
+  }
+
+  // Registers of the crashing thread, stack pointers of the others
+  CoreDumpEngine::ThreadList threads(1);
+  CoreDumpEngine::fillThreadState(threads.front(), self, *context);
+  threads.front().m_signal = signum;
+
+  // The helper writes from a healthy process; if it is gone, write the dump here
+  bool written = _requestHelperDump(signum, info, threads.front());
+  if(!written)
+  {
+    CoreDumpEngine::AddressList stackPointers;
+    CoreDumpEngine::readThreadStackPointers(getpid(), self, stackPointers);
+    CoreDumpEngine::CrashTarget target = _describeCrashTarget();
+    target.m_compress                  = false;
+    written                            = _writeCrashCore(target, signum, info, threads, stackPointers);
+  }
+  if(!written) return false;
+
+  // The dump is on disk; keep the kernel from writing a second, slower copy
+  struct rlimit coreLimit;
+  if(getrlimit(RLIMIT_CORE, &coreLimit) == 0)
+  {
+    coreLimit.rlim_cur = 0;
+    setrlimit(RLIMIT_CORE, &coreLimit);
+  }
+
+  char const message[] = "Crash dump written: ";
+  write(STDERR_FILENO, message, sizeof(message) - 1);
+  write(STDERR_FILENO, s_crashPath, std::strlen(s_crashPath));
+  write(STDERR_FILENO, "\n", 1);
+  return true;
+}
+
+bool
+CoreDumpGenerator::_writeCrashCore(CoreDumpEngine::CrashTarget const &target, int signum, siginfo_t const *info,
+                                   CoreDumpEngine::ThreadList &threads,
+                                   CoreDumpEngine::AddressList &stackPointers) noexcept
+{
+  try
+  {
+    pid_t const pid = target.m_identity.m_pid;
+
+    // Complete the preformatted prefix without snprintf or std::string
+    size_t length      = s_crashPrefixLength;
+    auto const append = [&length](char const *text)
+    { CoreDumpEngine::appendText(s_crashPath, sizeof(s_crashPath), length, text); };
+    auto const appendNumber = [&length](unsigned long long value)
+    { CoreDumpEngine::appendDecimal(s_crashPath, sizeof(s_crashPath), length, value); };
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    appendNumber(static_cast<unsigned long long>(signum));
+    append("_");
+    appendNumber(static_cast<unsigned long long>(now.tv_sec));
+    append("_");
+    appendNumber(static_cast<unsigned long long>(pid));
+    append("_");
+    appendNumber(static_cast<unsigned long long>(threads.front().m_tid));
+    append("_");
+    append(s_crashToken);
+    size_t const stemLength = length;
+    append(CoreDumpEngine::Constants::CRASH_RECORD_EXTENSION);
+    s_crashPath[length] = '\0';
+    int recordFd        = open(s_crashPath, O_CREAT | O_EXCL | O_WRONLY | O_CLOEXEC, 0640);
+    length              = stemLength;
+    append(".core");
+    if(target.m_compress) append(CoreDumpEngine::compressionExtension(target.m_codec));
+    s_crashPath[length] = '\0';
+
+    CoreDumpEngine::MemoryMap memoryMap;
+    ConfigStore::Reader const active(s_configStore);
+    bool const mapped = memoryMap.load(pid, &active->m_memoryFilter);
+    if(mapped && target.m_arenaEnd > target.m_arenaStart)
+      memoryMap.excludeRange(static_cast<std::uintptr_t>(target.m_arenaStart),
+                             static_cast<std::uintptr_t>(target.m_arenaEnd));
+    CoreDumpEngine::fillCrashRecord(s_crashRecord, pid, signum, info, threads.front());
+    if(mapped) CoreDumpEngine::resolveCrashModule(s_crashRecord, memoryMap);
+    if(signum == SIGSEGV && mapped
+       && CoreDumpEngine::trimOverflowedStack(memoryMap, CoreDumpEngine::stackPointerOf(threads.front()),
+                                              static_cast<std::uintptr_t>(s_crashRecord.m_faultAddress), stackPointers))
+    {
+      s_crashRecord.m_flags |= CoreDumpEngine::CrashFlags::STACK_OVERFLOW;
+      char const overflow[] = "Stack overflow detected, keeping the innermost and outermost frames\n";
+      write(STDERR_FILENO, overflow, sizeof(overflow) - 1);
+    }
+
+    // The sidecar goes out before the core so triage works even if the core is cut short
+    auto const writeRecord = [recordFd]()
+    { return recordFd >= 0 && pwrite(recordFd, &s_crashRecord, sizeof(s_crashRecord), 0) == sizeof(s_crashRecord); };
+    writeRecord();
+    if(!mapped)
+    {
+      if(recordFd >= 0) close(recordFd);
+      return false;
+    }
+    CoreDumpEngine::applyCaptureTier(target.m_type, memoryMap, threads, stackPointers);
+    CoreDumpEngine::ArenaVector<CoreDumpEngine::ExcludedRegion> excluded;
+    if(pid == getpid())
+      CoreDumpEngine::ExclusionRegistry::instance().snapshot(excluded);
+    else if(target.m_registryAddress != 0)
+      CoreDumpEngine::ExclusionRegistry::readRemote(pid, target.m_registryAddress, excluded);
+    CoreDumpEngine::excludeRegions(memoryMap, excluded);
+    CoreDumpEngine::BudgetPlan budgetPlan;
+    std::uint64_t const budget = target.m_maxSizeBytes;
+    if(budget > 0) CoreDumpEngine::planSizeBudget(memoryMap, threads, stackPointers, budget, budgetPlan);
+
+    int fd = open(s_crashPath, O_CREAT | O_EXCL | O_WRONLY | O_CLOEXEC, 0640);
+    if(fd < 0)
+    {
+      if(recordFd >= 0) close(recordFd);
+      return false;
+    }
+
+    // Compression codecs allocate their own state, so only the helper compresses
+    CoreDumpEngine::FileOutputSink fileSink(fd, target.m_sparse);
+    std::unique_ptr<CoreDumpEngine::OutputSink> compressedSink;
+    if(target.m_compress)
+    {
+      size_t const workerCount = std::max(1U, std::thread::hardware_concurrency()) - 1;
+      compressedSink = CoreDumpEngine::createOutputSink(fd, true, target.m_codec, target.m_level, workerCount);
+    }
+    bool written = !target.m_compress || compressedSink != nullptr;
+    if(written)
+    {
+      CoreDumpEngine::OutputSink &sink = compressedSink ? *compressedSink : fileSink;
+      CoreDumpEngine::CoreDumpStatistics stats;
+      CoreDumpEngine::ElfCoreWriter writer(sink, pid);
+      writer.setIdentity(target.m_identity);
+      writer.setReadAhead(!CoreDumpEngine::CrashArena::instance().isHeldByCaller()); // Only the helper may spawn
+      writer.setSkipNonResident(target.m_skipNonResident);
+      if(budget > 0)
+        writer.addNote(CoreDumpEngine::Constants::NOTE_NAME_CDGEN, CoreDumpEngine::Constants::NT_CDGEN_DROPPED_REGIONS,
+                       CoreDumpEngine::encodeDroppedRegions(budgetPlan));
+      if(!excluded.empty())
+        writer.addNote(CoreDumpEngine::Constants::NOTE_NAME_CDGEN, CoreDumpEngine::Constants::NT_CDGEN_EXCLUDED_REGIONS,
+                       CoreDumpEngine::encodeExcludedRegions(excluded));
+      CoreDumpEngine::ArenaVector<char> recordNote(sizeof(s_crashRecord));
+      std::memcpy(recordNote.data(), &s_crashRecord, sizeof(s_crashRecord));
+      writer.addNote(CoreDumpEngine::Constants::NOTE_NAME_CDGEN, CoreDumpEngine::Constants::NT_CDGEN_CRASH_RECORD,
+                     std::move(recordNote));
+      written = writer.write(memoryMap, threads, stats);
+    }
+    compressedSink.reset(); // Joins the compression threads before the descriptor is closed
+    bool const closed = (close(fd) == 0);
+    if(!written || !closed)
+    {
+      if(recordFd >= 0) close(recordFd);
+      unlink(s_crashPath);
+      return false;
+    }
+    s_crashRecord.m_flags |= CoreDumpEngine::CrashFlags::CORE_WRITTEN;
+    writeRecord();
+    if(recordFd >= 0) close(recordFd);
+    return true;
+  }
+  catch(...)
+  {
+    return false; // Only in the helper: in the crashing process arena allocations never throw
+  }
+}
+
+CoreDumpEngine::CrashTarget
+CoreDumpGenerator::_describeCrashTarget() noexcept
+{
+  ConfigStore::Reader const active(s_configStore);
+  DumpConfiguration const &config         = active->m_config;
+  CoreDumpEngine::CrashArena const &arena = CoreDumpEngine::CrashArena::instance();
+  CoreDumpEngine::CrashTarget target;
+  target.m_identity        = CoreDumpEngine::ProcessIdentity::current();
+  target.m_arenaStart      = reinterpret_cast<std::uintptr_t>(arena.base());
+  target.m_arenaEnd        = target.m_arenaStart + (arena.base() != nullptr ? arena.size() : 0);
+  target.m_maxSizeBytes    = config.getMaxSizeBytes();
+  target.m_type            = config.getType();
+  target.m_codec           = config.getCompressionCodec();
+  target.m_level           = config.getCompressionLevel();
+  target.m_compress
+    = config.isCompress() && CoreDumpEngine::isCompressionAvailable(config.getCompressionCodec());
+  target.m_sparse          = config.isSparse();
+  target.m_skipNonResident = config.isSkipNonResident();
+  target.m_registryAddress = reinterpret_cast<std::uintptr_t>(&CoreDumpEngine::ExclusionRegistry::instance());
+  return target;
+}
+
+void
+CoreDumpGenerator::_startCrashHelper() noexcept
+{
+  try
+  {
+    if(s_crashPrefixLength == 0) return; // Crash dumps are disabled altogether
+
+    // A helper that never reached runCrashHelper() must not start the application a second time
+    CoreDumpEngine::ArenaVector<char> commandLine;
+    if(CoreDumpEngine::readProcFile(getpid(), "cmdline", commandLine))
+    {
+      char const *const end = commandLine.data() + commandLine.size();
+      char const *argument  = static_cast<char const *>(std::memchr(commandLine.data(), '\0', commandLine.size()));
+      if(argument != nullptr && ++argument < end
+         && std::strncmp(argument, CoreDumpEngine::Constants::CRASH_HELPER_ARGUMENT,
+                         static_cast<size_t>(end - argument))
+              == 0)
+      {
+        _logMessage("Crash helper started without runCrashHelper() at the start of main(), exiting", true);
+        _exit(EXIT_FAILURE);
+      }
+    }
+
+    int sockets[2] = {-1, -1};
+    if(socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets) != 0)
+    {
+      _logMessage("WARNING: socketpair() for the crash helper failed: " + std::string(std::strerror(errno)), true);
+      return;
+    }
+    // dup2() onto the helper descriptor clears FD_CLOEXEC, unless both are the same descriptor
+    if(sockets[1] == CoreDumpEngine::Constants::CRASH_HELPER_FD)
+    {
+      int const moved = fcntl(sockets[1], F_DUPFD_CLOEXEC, CoreDumpEngine::Constants::CRASH_HELPER_FD + 1);
+      close(sockets[1]);
+      sockets[1] = moved;
+    }
+
+    ConfigStore::Reader const active(s_configStore);
+    std::string path = active->m_config.getCrashHelperPath();
+    if(path.empty()) path = "/proc/self/exe"; // Resolved in the child: this executable
+    std::string argument = CoreDumpEngine::Constants::CRASH_HELPER_ARGUMENT;
+    char *helperArgv[]   = {&path[0], &argument[0], nullptr};
+
+    pid_t helper = 0;
+    int spawnError = EBADF;
+    posix_spawn_file_actions_t actions;
+    if(sockets[1] >= 0 && posix_spawn_file_actions_init(&actions) == 0)
+    {
+      spawnError = posix_spawn_file_actions_adddup2(&actions, sockets[1], CoreDumpEngine::Constants::CRASH_HELPER_FD);
+      if(spawnError == 0) spawnError = posix_spawn(&helper, path.c_str(), &actions, nullptr, helperArgv, environ);
+      posix_spawn_file_actions_destroy(&actions);
+    }
+    if(sockets[1] >= 0) close(sockets[1]);
+    if(spawnError != 0)
+    {
+      close(sockets[0]);
+      _logMessage("WARNING: Failed to spawn crash helper " + path + ": " + std::string(std::strerror(spawnError)),
+                  true);
+      return;
+    }
+
+    // Yama ptrace_scope=1 only lets ancestors attach; the helper is a child
+    prctl(PR_SET_PTRACER, static_cast<unsigned long>(helper), 0, 0, 0);
+
+    CoreDumpEngine::CrashTarget const target = _describeCrashTarget();
+    std::string hello(reinterpret_cast<char const *>(&target), sizeof(target));
+    hello.append(s_crashPath, s_crashPrefixLength);
+    hello.push_back('\0');
+    hello.append(s_crashToken);
+    hello.push_back('\0');
+    for(auto const &filter : active->m_config.getMemoryFilters())
+    {
+      hello.append(filter);
+      hello.push_back('\0');
+    }
+
+    // The helper answers once it has parsed the target
+    struct timeval timeout = {CoreDumpEngine::Constants::CRASH_HELPER_START_SECONDS, 0};
+    setsockopt(sockets[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    std::uint32_t version = 0;
+    if(send(sockets[0], hello.data(), hello.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(hello.size())
+       || recv(sockets[0], &version, sizeof(version), 0) != sizeof(version)
+       || version != CoreDumpEngine::Constants::CRASH_HELPER_VERSION)
+    {
+      close(sockets[0]);
+      kill(helper, SIGKILL);
+      waitpid(helper, nullptr, 0);
+      _logMessage("WARNING: Crash helper did not start; call CoreDumpGenerator::runCrashHelper() first in main()",
+                  true);
+      return;
+    }
+    timeout.tv_sec = CoreDumpEngine::Constants::CRASH_HELPER_STALL_SECONDS;
+    setsockopt(sockets[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    // A restarted helper takes over the old descriptor number, so a concurrent crash never sees it closed or reused
+    if(s_helperSocket >= 0 && dup3(sockets[0], s_helperSocket, O_CLOEXEC) < 0)
+    {
+      close(sockets[0]);
+      kill(helper, SIGKILL);
+      waitpid(helper, nullptr, 0);
+      _logMessage("WARNING: Failed to connect the restarted crash helper: " + std::string(std::strerror(errno)), true);
+      return;
+    }
+    if(s_helperSocket >= 0)
+      close(sockets[0]);
+    else
+      s_helperSocket = sockets[0];
+    s_helperPid.store(helper);
+    s_helperClient = getpid();
+    _logMessage("Crash helper process " + std::to_string(helper) + " started", false);
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to start crash helper: " + std::string(exc.what()), true);
+  }
+}
+
+void
+CoreDumpGenerator::_checkCrashHelper() noexcept
+{
+  try
+  {
+    std::lock_guard<std::mutex> lock(s_helperMutex);
+    pid_t const helper = s_helperPid.load();
+    if(helper <= 0 || getpid() != s_helperClient) return;
+
+    // Peek without reaping: the crash path must stop using the PID before it can be reused
+    siginfo_t info;
+    std::memset(&info, 0, sizeof(info));
+    int const peeked = waitid(P_PID, static_cast<id_t>(helper), &info, WEXITED | WNOHANG | WNOWAIT);
+    if(peeked == 0 ? info.si_pid != helper : errno != ECHILD) return; // Still running
+    s_helperPid.store(0);
+    waitpid(helper, nullptr, WNOHANG);
+
+    std::string cause = "was reaped by another waiter";
+    if(peeked == 0)
+      cause = info.si_code == CLD_EXITED ? "exited with status " + std::to_string(info.si_status)
+                                         : "was killed by signal " + std::to_string(info.si_status);
+    cause = "WARNING: Crash helper process " + std::to_string(helper) + " " + cause;
+    if(s_helperRestarts >= CoreDumpEngine::Constants::CRASH_HELPER_RESTARTS
+       || !ConfigStore::Reader(s_configStore)->m_config.isCrashHelper())
+    {
+      _logMessage(cause + ", crash dumps are written in-process from now on", true);
+      return;
+    }
+    ++s_helperRestarts;
+    _logMessage(cause + ", restarting it", true);
+    _startCrashHelper();
+  }
+  catch(std::exception const &exc)
+  {
+    _logMessage("Failed to check crash helper: " + std::string(exc.what()), true);
+  }
+}
+
+bool
+CoreDumpGenerator::_serveCrashHelper(int fd) noexcept
+{
+  try
+  {
+    // Terminal signals are meant for the application; the helper ends when the socket closes
+    signal(SIGINT, SIG_IGN);
+    signal(SIGQUIT, SIG_IGN);
+    signal(SIGTSTP, SIG_IGN);
+    signal(SIGPIPE, SIG_IGN);
+
+    ssize_t const helloSize = recv(fd, nullptr, 0, MSG_PEEK | MSG_TRUNC);
+    if(helloSize < static_cast<ssize_t>(sizeof(CoreDumpEngine::CrashTarget))) return false;
+    std::vector<char> hello(static_cast<size_t>(helloSize) + 1, '\0'); // Terminates the last string
+    if(recv(fd, hello.data(), static_cast<size_t>(helloSize), 0) != helloSize) return false;
+
+    CoreDumpEngine::CrashTarget target;
+    std::memcpy(&target, hello.data(), sizeof(target));
+    if(target.m_version != CoreDumpEngine::Constants::CRASH_HELPER_VERSION) return false;
+
+    std::vector<std::string> strings;
+    for(size_t offset = sizeof(target); offset < static_cast<size_t>(helloSize);)
+    {
+      strings.emplace_back(hello.data() + offset);
+      offset += strings.back().size() + 1;
+    }
+    if(strings.size() < 2 || strings[0].size() + 96 >= sizeof(s_crashPath)) return false;
+    std::memcpy(s_crashPath, strings[0].data(), strings[0].size());
+    s_crashPrefixLength   = strings[0].size();
+    size_t const tokenSize = std::min(strings[1].size(), sizeof(s_crashToken) - 1);
+    std::memcpy(s_crashToken, strings[1].data(), tokenSize);
+    s_crashToken[tokenSize] = '\0';
+    DumpConfiguration filters; // Only the memory filters reach the helper
+    for(auto filter = strings.begin() + 2; filter != strings.end(); ++filter)
+      if(!filters.addMemoryFilter(*filter))
+      {
+        filters = DumpConfiguration(); // Malformed = capture all
+        break;
+      }
+    s_configStore.publish(filters);
+
+    std::uint32_t const version = CoreDumpEngine::Constants::CRASH_HELPER_VERSION;
+    if(send(fd, &version, sizeof(version), MSG_NOSIGNAL) != sizeof(version)) return false;
+
+    for(;;)
+    {
+      CoreDumpEngine::HelperRequest request;
+      ssize_t received;
+      do
+        received = recv(fd, &request, sizeof(request), 0);
+      while(received < 0 && errno == EINTR);
+      if(received == 0) return true; // Every copy of the other end is closed: the process is gone
+      if(received < 0) return false;
+
+      CoreDumpEngine::HelperReply reply;
+      if(received == sizeof(request) && request.m_version == CoreDumpEngine::Constants::CRASH_HELPER_VERSION
+         && request.m_pid == target.m_identity.m_pid)
+      {
+        // Stop the other threads so the memory stays consistent while it is copied
+        CoreDumpEngine::ThreadList threads(1, request.m_thread);
+        CoreDumpEngine::AddressList stackPointers;
+        CoreDumpEngine::ArenaVector<pid_t> seized;
+        CoreDumpEngine::seizeThreads(request.m_pid, request.m_thread.m_tid, threads, stackPointers, seized);
+        reply.m_written = _writeCrashCore(target, request.m_signal, request.m_hasInfo != 0 ? &request.m_info : nullptr,
+                                          threads, stackPointers)
+                            ? 1
+                            : 0;
+        CoreDumpEngine::releaseThreads(seized);
+        if(reply.m_written != 0)
+          std::memcpy(reply.m_path, s_crashPath, std::min(std::strlen(s_crashPath), sizeof(reply.m_path) - 1));
+      }
+      send(fd, &reply, sizeof(reply), MSG_NOSIGNAL);
+    }
+  }
+  catch(...)
+  {
+    return false;
+  }
+}
+
+bool
+CoreDumpGenerator::_requestHelperDump(int signum, siginfo_t const *info,
+                                      CoreDumpEngine::ThreadState const &thread) noexcept
+{
+  if(s_helperSocket < 0 || getpid() != s_helperClient) return false;
+
+  CoreDumpEngine::HelperRequest request{};
+  request.m_pid     = static_cast<std::int32_t>(getpid());
+  request.m_signal  = signum;
+  request.m_hasInfo = info != nullptr ? 1 : 0;
+  if(info != nullptr) request.m_info = *info;
+  request.m_thread = thread;
+  if(send(s_helperSocket, &request, sizeof(request), MSG_NOSIGNAL) != static_cast<ssize_t>(sizeof(request)))
+    return false;
+
+  // A large process can take the helper minutes: wait as long as it keeps writing, every
+  // CRASH_HELPER_STALL_SECONDS (SO_RCVTIMEO). EOF (helper died) and a stall fall back to the in-process writer.
+  CoreDumpEngine::HelperReply reply;
+  CoreDumpEngine::ArenaVector<char> content;
+  std::uint64_t lastWritten = 0;
+  ssize_t received;
+  for(;;)
+  {
+    received = recv(s_helperSocket, &reply, sizeof(reply), 0);
+    if(received >= 0 || (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)) break;
+    if(errno == EINTR) continue;
+
+    pid_t const helper    = s_helperPid.load();
+    std::uint64_t written = 0;
+    if(helper <= 0 || !CoreDumpEngine::readWriteCount(helper, content, written) || written == lastWritten)
+    {
+      if(helper > 0) kill(helper, SIGKILL); // A stalled helper must not write next to the in-process dump
+      return false;
+    }
+    lastWritten = written;
+  }
+  if(received != static_cast<ssize_t>(sizeof(reply)) || reply.m_written == 0) return false;
+
+  reply.m_path[sizeof(reply.m_path) - 1] = '\0';
+  std::memcpy(s_crashPath, reply.m_path, std::strlen(reply.m_path) + 1);
+  return true;
+}
+
 void
 CoreDumpGenerator::_customSignalHandlerWrapper(int signum) noexcept
 {
@@ -3396,7 +10247,7 @@ CoreDumpGenerator::_customSignalHandlerWrapper(int signum) noexcept
 
 // Helper function to check and log core dump file size
 void
-CoreDumpGenerator::_logCoreDumpSize(std::string const &filename) noexcept
+CoreDumpGenerator::_logCoreDumpSize(std::string const &filename, std::uint64_t coreBytes) noexcept
 {
   try
   {
@@ -3406,6 +10257,16 @@ CoreDumpGenerator::_logCoreDumpSize(std::string const &filename) noexcept
       _logMessage("Core dump created successfully. Path: " + filename + ". Size: " + std::to_string(fileStat.st_size)
                     + " bytes",
                   false);
+
+      auto const bytesWritten = static_cast<std::uint64_t>(fileStat.st_size);
+      if(coreBytes > 0 && bytesWritten > 0 && coreBytes != bytesWritten)
+      {
+        std::ostringstream oss;
+        oss << "Compressed core: " << bytesWritten << " bytes written for " << coreBytes
+            << " bytes of core data (ratio " << std::fixed << std::setprecision(2)
+            << static_cast<double>(coreBytes) / static_cast<double>(bytesWritten) << ":1)";
+        _logMessage(oss.str(), false);
+      }
     }
     else
     {
@@ -3446,6 +10307,25 @@ CoreDumpGenerator::_generateCoreDump()
     filename << s_dumpDirectory << "/core_dump_full_%t_%p_%e.core";
 
     std::string core_pattern = filename.str();
+
+    // Pipe helper: the kernel streams the core to it instead of writing the file synchronously
+    ConfigStore::Reader const active(s_configStore);
+    std::string const helperPath = active->m_config.getCorePatternHelperPath();
+    if(!helperPath.empty())
+    {
+      std::string compression = "none";
+      if(active->m_config.isCompress())
+        compression = std::string(active->m_config.getCompressionCodec() == CompressionCodec::LZ4 ? "lz4:" : "zstd:")
+                      + std::to_string(active->m_config.getCompressionLevel());
+      std::string const piped = "|" + helperPath + " " + s_dumpDirectory + " " + compression + " %t %p %s %u %g %e";
+      if(access(helperPath.c_str(), X_OK) != 0)
+        _logMessage("WARNING: Core pattern helper " + helperPath + " is not executable, kernel writes cores itself",
+                    true);
+      else if(piped.size() > CoreDumpEngine::Constants::CORE_PATTERN_MAX_LENGTH)
+        _logMessage("WARNING: Piped core_pattern exceeds 127 bytes, kernel writes cores itself: " + piped, true);
+      else
+        core_pattern = piped;
+    }
     _logMessage("Core dump pattern: " + core_pattern, false);
     _logMessage("  %t = crash timestamp, %p = PID, %e = executable name", false);
 
@@ -3455,28 +10335,23 @@ CoreDumpGenerator::_generateCoreDump()
     core_limit.rlim_max = RLIM_INFINITY;
     setrlimit(RLIMIT_CORE, &core_limit);
 
-    // Set core pattern to create file with our name (PRIMARY mechanism: sudo tee)
-    std::string core_pattern_cmd = "echo \"" + core_pattern + "\" | sudo tee /proc/sys/kernel/core_pattern";
-    int ret                      = system(core_pattern_cmd.c_str());
-
-    if(ret != 0)
+    // Set core pattern to create file with our name. A direct write needs no child process; sudo is only
+    // tried without it and with -n, so a missing sudoers entry fails at once instead of prompting
+    int fd = open("/proc/sys/kernel/core_pattern", O_WRONLY | O_TRUNC | O_CLOEXEC);
+    if(fd >= 0)
     {
-      _logMessage("WARNING: sudo tee failed, attempting direct write", true);
-
-      // Try direct write (will fail on most systems but worth trying)
-      int fd = open("/proc/sys/kernel/core_pattern", O_WRONLY | O_TRUNC);
-      if(fd >= 0)
+      ssize_t written = write(fd, core_pattern.c_str(), core_pattern.length());
+      close(fd);
+      if(written > 0)
       {
-        ssize_t written = write(fd, core_pattern.c_str(), core_pattern.length());
-        close(fd);
-        if(written > 0)
-        {
-          _logMessage("Direct write successful (no sudo required)", false);
-          _logMessage("Core dump generation configured", false);
-          return;
-        }
+        _logMessage("Direct write successful (no sudo required)", false);
+        _logMessage("Core dump generation configured", false);
+        return;
       }
+    }
 
+    if(!_writeCorePatternWithSudo(core_pattern))
+    {
       _logMessage("WARNING: Cannot set custom core_pattern - will use system default", true);
       _logMessage("  Core dumps will be handled by systemd-coredump if available", false);
       _logMessage("  or created as './core' in current directory", false);
@@ -3492,6 +10367,65 @@ CoreDumpGenerator::_generateCoreDump()
   }
 }
 
+bool
+CoreDumpGenerator::_writeCorePatternWithSudo(std::string const &pattern) noexcept
+{
+  try
+  {
+    // The pattern (at most 127 bytes) fits the pipe buffer, so it is written before sudo starts and a sudo that
+    // exits without reading cannot raise SIGPIPE here
+    int input[2] = {-1, -1};
+    if(pipe2(input, O_CLOEXEC) != 0) return false;
+    std::string const line = pattern + "\n";
+    ssize_t const queued   = write(input[1], line.data(), line.size());
+    close(input[1]);
+    // dup2() onto stdin clears FD_CLOEXEC, unless both are the same descriptor
+    if(input[0] == STDIN_FILENO)
+    {
+      int const moved = fcntl(input[0], F_DUPFD_CLOEXEC, STDIN_FILENO + 1);
+      close(input[0]);
+      input[0] = moved;
+    }
+    if(queued != static_cast<ssize_t>(line.size()) || input[0] < 0)
+    {
+      if(input[0] >= 0) close(input[0]);
+      return false;
+    }
+
+    std::string program = "sudo";
+    std::string option  = "-n"; // Fail at once instead of prompting for a password
+    std::string tee     = "tee";
+    std::string target  = "/proc/sys/kernel/core_pattern";
+    char *sudoArgv[]    = {&program[0], &option[0], &tee[0], &target[0], nullptr};
+    pid_t sudo          = 0;
+    int spawnError      = EBADF;
+    posix_spawn_file_actions_t actions;
+    if(posix_spawn_file_actions_init(&actions) == 0)
+    {
+      spawnError = posix_spawn_file_actions_adddup2(&actions, input[0], STDIN_FILENO);
+      if(spawnError == 0)
+        spawnError = posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+      if(spawnError == 0) spawnError = posix_spawnp(&sudo, program.c_str(), &actions, nullptr, sudoArgv, environ);
+      posix_spawn_file_actions_destroy(&actions);
+    }
+    close(input[0]);
+    if(spawnError != 0)
+    {
+      _logMessage("Cannot run sudo: " + std::string(std::strerror(spawnError)), false);
+      return false;
+    }
+
+    int status = 0;
+    pid_t reaped = -1;
+    while((reaped = waitpid(sudo, &status, 0)) < 0 && errno == EINTR) {}
+    return reaped == sudo && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  }
+  catch(...)
+  {
+    return false;
+  }
+}
+
   // Helper function to set core pattern for crash (like in the working example)
 
 #endif // DUMP_CREATOR_UNIX
@@ -3532,6 +10466,16 @@ CoreDumpGenerator::_logDumpCreationSuccess(std::string const &filename, size_t s
     else
       oss << ". Size: unknown";
 
+#if DUMP_CREATOR_UNIX
+    // Sparse and compressed cores occupy less disk than their apparent size
+    struct stat fileStat;
+    if(stat(filename.c_str(), &fileStat) == 0)
+    {
+      oss << ". Logical size: " << static_cast<unsigned long long>(fileStat.st_size)
+          << " bytes, physical size: " << static_cast<unsigned long long>(fileStat.st_blocks) * 512ULL << " bytes";
+    }
+#endif
+
     // Use direct logging for dump creation success to avoid path sanitization
     std::string timeStr = formatTime("%H:%M:%S");
     std::cout << "[" << timeStr << "] INFO: " << oss.str() << '\n';
@@ -3771,7 +10715,7 @@ DumpFactory::isSupported(DumpType type) noexcept
 #elif DUMP_CREATOR_UNIX
   // UNIX supports core dump types
   return (static_cast<int>(type) >= static_cast<int>(DumpType::CORE_DUMP_FULL)
-          && static_cast<int>(type) <= static_cast<int>(DumpType::CORE_DUMP_FULL))
+          && static_cast<int>(type) <= static_cast<int>(DumpType::CORE_DUMP_COMPRESSED))
          || (type == DumpType::DEFAULT_UNIX);
 #else
   return false;
@@ -3884,6 +10828,19 @@ DumpFactory::createUnixConfiguration(DumpType type)
     // Set reasonable limit to prevent DoS attacks (1GB max)
     config.setMaxSizeBytes(1024ULL * 1024ULL * 1024ULL); // 1GB
     break;
+  case DumpType::CORE_DUMP_STACK_ONLY:
+    config.setMaxSizeBytes(8ULL * 1024ULL * 1024ULL); // 8MB - room for many threads
+    break;
+  case DumpType::CORE_DUMP_STACKS_AND_DATA:
+    config.setMaxSizeBytes(64ULL * 1024ULL * 1024ULL); // 64MB
+    break;
+  case DumpType::CORE_DUMP_HEAP_FILTERED:
+    config.setMaxSizeBytes(512ULL * 1024ULL * 1024ULL); // 512MB
+    break;
+  case DumpType::CORE_DUMP_COMPRESSED:
+    config.setCompress(true);
+    config.setMaxSizeBytes(1024ULL * 1024ULL * 1024ULL); // 1GB before compression
+    break;
   default:
     // Use default settings with reasonable limits
     config.setMaxSizeBytes(128ULL * 1024ULL * 1024ULL); // 128MB default limit
@@ -3950,47 +10907,48 @@ CoreDumpGenerator::_setupExceptionHandling()
 void
 CoreDumpGenerator::_unhandledExceptionHandler()
 {
+#if DUMP_CREATOR_UNIX
+  // terminate() may run after heap corruption: stay on the allocation-free crash path.
+  // The SIGABRT raised by std::abort() below finds the dump already written.
+  char const message[] = "Unhandled C++ exception detected\n";
+  auto bytes_written   = write(STDERR_FILENO, message, sizeof(message) - 1);
+  (void)bytes_written;
+  if(isInitialized()) _writeCrashDump(SIGABRT, nullptr, nullptr);
+#else
   try
   {
     _logMessage("Unhandled C++ exception detected", true);
 
     // Generate dump for the exception with proper synchronization
     // Use atomic load to safely check initialization status
-#if CPP11_OR_GREATER
+  #if CPP11_OR_GREATER
     bool isInitialized = s_initialized.load(std::memory_order_acquire);
-#else
+  #else
     bool isInitialized = s_initialized;
-#endif
+  #endif
 
     if(isInitialized)
     {
       // Create a local copy of configuration to avoid accessing potentially
       // destroyed static data
-      DumpConfiguration localConfig = s_currentConfig;
+      DumpConfiguration localConfig = getCurrentConfiguration();
       std::string filename          = _generateDumpFilename("unhandled_exception");
       _logMessage("Generating exception dump: " + filename, false);
 
-#if DUMP_CREATOR_WINDOWS
+  #if DUMP_CREATOR_WINDOWS
       _createWindowsDump(filename, localConfig);
-#elif DUMP_CREATOR_UNIX
-      _generateCoreDump();
-#endif
+  #endif
     }
     else { _logMessage("CoreDumpGenerator not initialized, skipping dump generation", true); }
   }
   catch(...)
   {
     // If exception handling fails, just log to stderr
-    // Use only async-signal-safe functions in exception handler
-    char const errorMsg[] = "Failed to handle unhandled exception\n";
-#if DUMP_CREATOR_UNIX
-    auto bytes_written = write(STDERR_FILENO, errorMsg, sizeof(errorMsg) - 1);
-    if(bytes_written == -1) _logMessage("Failed to write to stderr: " + std::to_string(errno), true);
-#else
-    // Windows fallback
-    OutputDebugStringA(errorMsg);
-#endif
+  #if DUMP_CREATOR_WINDOWS
+    OutputDebugStringA("Failed to handle unhandled exception\n");
+  #endif
   }
+#endif
 
   // Call the default terminate handler
   std::abort();
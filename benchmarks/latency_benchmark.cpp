@@ -0,0 +1,540 @@
+// NOLINTBEGIN
+
+// Startup and crash-path latency of CoreDumpGenerator, written as JSON so that
+// runs before and after a library upgrade can be compared.
+//
+// Usage: CoreDumpGeneratorLatencyBenchmark [--heap-mb LIST] [--runs N] [--dir PATH] [--output FILE]
+//   --heap-mb  Comma-separated heap sizes (default 256,1024,4096,16384). Sizes above 3/4 of
+//              MemAvailable or above the free space in --dir are skipped and listed as such
+//   --runs     Repetitions of every measurement; min, median and max are reported (default 3)
+//   --dir      Dump directory, emptied after every run (default: a new directory in /tmp)
+//   --output   JSON result file (default CoreDumpGeneratorLatencyBenchmark.json)
+//
+// Measured:
+//   initialize      Return and ready time of initialize(), deferred and synchronous, in fresh children
+//   generate_dump   generateDump() latency and throughput of a CORE_DUMP_FULL dump per heap size
+//   crash           Forked children that fault with the heap mapped: fault to the first byte of the
+//                   crash core (inotify IN_MODIFY), to the core being closed (IN_CLOSE_WRITE) and
+//                   to the child's exit
+//
+// initialize() may change /proc/sys/kernel/core_pattern; the original value is written back at exit.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/statvfs.h>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+
+#include "CoreDumpGenerator.hpp"
+
+namespace
+{
+  constexpr int CRASH_TIMEOUT_SECONDS = 600;
+
+  /**
+   * @brief Written by a forked child, read by the parent once the child has exited
+   */
+  struct ChildTimes {
+    std::int64_t m_initStartNs  = 0;
+    std::int64_t m_initReturnNs = 0;
+    std::int64_t m_initReadyNs  = 0;
+    std::int64_t m_faultNs      = 0;
+  };
+
+  struct Statistics {
+    double m_min    = 0;
+    double m_median = 0;
+    double m_max    = 0;
+  };
+
+  struct Options {
+    std::vector<size_t> m_heapMegabytes = {256, 1024, 4096, 16384};
+    int m_runs                          = 3;
+    std::string m_directory;
+    std::string m_output = "CoreDumpGeneratorLatencyBenchmark.json";
+  };
+
+  // CLOCK_MONOTONIC is shared by all processes, so child and parent timestamps can be subtracted
+  std::int64_t
+  monotonicNanoseconds()
+  {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+  }
+
+  Statistics
+  summarize(std::vector<double> values)
+  {
+    Statistics stats;
+    if(values.empty()) return stats;
+    std::sort(values.begin(), values.end());
+    stats.m_min    = values.front();
+    stats.m_max    = values.back();
+    stats.m_median = values.size() % 2 != 0 ? values[values.size() / 2]
+                                            : (values[values.size() / 2 - 1] + values[values.size() / 2]) / 2;
+    return stats;
+  }
+
+  std::string
+  toJson(Statistics const &stats)
+  {
+    char text[128];
+    std::snprintf(text, sizeof(text), "{\"min\": %.3f, \"median\": %.3f, \"max\": %.3f}", stats.m_min,
+                  stats.m_median, stats.m_max);
+    return text;
+  }
+
+  std::string
+  quoted(std::string const &value)
+  {
+    std::string result = "\"";
+    for(char c : value)
+    {
+      if(c == '"' || c == '\\') result.push_back('\\');
+      if(static_cast<unsigned char>(c) >= 0x20) result.push_back(c);
+    }
+    return result + "\"";
+  }
+
+  size_t
+  availableMegabytes()
+  {
+    std::FILE *meminfo = std::fopen("/proc/meminfo", "r");
+    if(meminfo == nullptr) return 0;
+    char line[256];
+    unsigned long long kilobytes = 0;
+    while(std::fgets(line, sizeof(line), meminfo) != nullptr)
+      if(std::sscanf(line, "MemAvailable: %llu kB", &kilobytes) == 1) break;
+    std::fclose(meminfo);
+    return static_cast<size_t>(kilobytes / 1024);
+  }
+
+  size_t
+  freeDiskMegabytes(std::string const &directory)
+  {
+    struct statvfs fs;
+    if(statvfs(directory.c_str(), &fs) != 0) return 0;
+    return static_cast<size_t>(static_cast<unsigned long long>(fs.f_bavail) * fs.f_frsize / (1024ULL * 1024ULL));
+  }
+
+  bool
+  readCorePattern(std::string &pattern)
+  {
+    std::FILE *file = std::fopen("/proc/sys/kernel/core_pattern", "r");
+    if(file == nullptr) return false;
+    char line[256] = {};
+    bool const read = std::fgets(line, sizeof(line), file) != nullptr;
+    std::fclose(file);
+    pattern = line;
+    if(!pattern.empty() && pattern.back() == '\n') pattern.pop_back();
+    return read;
+  }
+
+  void
+  writeCorePattern(std::string const &pattern)
+  {
+    int fd = open("/proc/sys/kernel/core_pattern", O_WRONLY | O_TRUNC | O_CLOEXEC);
+    if(fd < 0) return;
+    ssize_t const written = write(fd, pattern.data(), pattern.size());
+    (void)written;
+    close(fd);
+  }
+
+  /**
+   * @brief Delete the files in directory; returns the size of the largest *.core* file
+   */
+  unsigned long long
+  clearDirectory(std::string const &directory)
+  {
+    unsigned long long coreBytes = 0;
+    DIR *dir = opendir(directory.c_str());
+    if(dir == nullptr) return 0;
+    while(struct dirent *entry = readdir(dir))
+    {
+      std::string const name = entry->d_name;
+      if(name == "." || name == "..") continue;
+      std::string const path = directory + "/" + name;
+      struct stat st;
+      if(name.find(".core") != std::string::npos && stat(path.c_str(), &st) == 0)
+        coreBytes = std::max(coreBytes, static_cast<unsigned long long>(st.st_size));
+      unlink(path.c_str());
+    }
+    closedir(dir);
+    return coreBytes;
+  }
+
+  /**
+   * @brief Map and touch a heap with non-zero pages, so sparse output cannot skip it
+   */
+  char *
+  allocateHeap(size_t bytes)
+  {
+    void *memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(memory == MAP_FAILED) return nullptr;
+    char *data            = static_cast<char *>(memory);
+    size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for(size_t offset = 0; offset < bytes; offset += pageSize)
+      std::memset(data + offset, static_cast<int>((offset / pageSize) % 251 + 1), pageSize);
+    return data;
+  }
+
+  DumpConfiguration
+  benchmarkConfiguration(std::string const &directory, bool deferred)
+  {
+    DumpConfiguration config = DumpFactory::createConfiguration(DumpType::CORE_DUMP_FULL);
+    config.setDirectory(directory);
+    config.setDeferredSetup(deferred);
+    config.setMaxSizeBytes(0); // The whole heap, not the 1GB default budget
+    return config;
+  }
+
+  /**
+   * @brief Initialize the library in a fresh child and record when initialize() returns and when it is ready
+   * @return Child's wait status, or -1 if it could not be started
+   */
+  int
+  initializeInChild(DumpConfiguration const &config, ChildTimes *times)
+  {
+    *times    = ChildTimes();
+    pid_t pid = fork();
+    if(pid < 0) return -1;
+    if(pid == 0)
+    {
+      times->m_initStartNs = monotonicNanoseconds();
+      CoreDumpGenerator::initialize(config);
+      times->m_initReturnNs = monotonicNanoseconds();
+      CoreDumpGenerator::waitUntilReady();
+      times->m_initReadyNs = monotonicNanoseconds();
+      _exit(EXIT_SUCCESS);
+    }
+    int status = 0;
+    while(waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+    return status;
+  }
+
+  std::string
+  measureInitialize(Options const &options, ChildTimes *times, bool deferred)
+  {
+    DumpConfiguration const config = benchmarkConfiguration(options.m_directory, deferred);
+    std::vector<double> returnMicroseconds;
+    std::vector<double> readyMicroseconds;
+    for(int run = 0; run < options.m_runs; ++run)
+    {
+      int const status = initializeInChild(config, times);
+      clearDirectory(options.m_directory);
+      if(status != 0 || times->m_initReadyNs == 0) continue;
+      returnMicroseconds.push_back(static_cast<double>(times->m_initReturnNs - times->m_initStartNs) / 1e3);
+      readyMicroseconds.push_back(static_cast<double>(times->m_initReadyNs - times->m_initStartNs) / 1e3);
+    }
+    std::fprintf(stderr, "initialize (%s): %.0f us to return, %.0f us to ready\n",
+                 deferred ? "deferred" : "synchronous", summarize(returnMicroseconds).m_median,
+                 summarize(readyMicroseconds).m_median);
+    return "{\"samples\": " + std::to_string(returnMicroseconds.size())
+           + ", \"return_us\": " + toJson(summarize(returnMicroseconds))
+           + ", \"ready_us\": " + toJson(summarize(readyMicroseconds)) + "}";
+  }
+
+  /**
+   * @brief Fault in a child with heapMegabytes mapped and time the crash core through inotify
+   */
+  bool
+  measureCrash(Options const &options, ChildTimes *times, size_t heapMegabytes, double &firstByteMicroseconds,
+               double &closedMilliseconds, double &exitMilliseconds, unsigned long long &coreBytes)
+  {
+    int const notify = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+    if(notify < 0) return false;
+    int watch = inotify_add_watch(notify, options.m_directory.c_str(), IN_MODIFY | IN_CLOSE_WRITE);
+
+    *times    = ChildTimes();
+    pid_t pid = fork();
+    if(pid < 0 || watch < 0)
+    {
+      close(notify);
+      return false;
+    }
+    if(pid == 0)
+    {
+      char *heap = allocateHeap(heapMegabytes * 1024ULL * 1024ULL);
+      if(heap == nullptr) _exit(EXIT_FAILURE);
+      CoreDumpGenerator::initialize(benchmarkConfiguration(options.m_directory, true));
+      CoreDumpGenerator::waitUntilReady();
+      int volatile *volatile nowhere = nullptr; // Neither folded into a trap nor dropped as a dead store
+      times->m_faultNs               = monotonicNanoseconds();
+      *nowhere                       = heap[0];
+      _exit(EXIT_FAILURE);
+    }
+
+    std::int64_t firstByteNs = 0;
+    std::int64_t closedNs    = 0;
+    std::int64_t exitNs      = 0;
+    int status               = 0;
+    std::int64_t const deadline = monotonicNanoseconds() + CRASH_TIMEOUT_SECONDS * 1000000000LL;
+    alignas(struct inotify_event) char buffer[16384];
+    while(closedNs == 0 || exitNs == 0)
+    {
+      if(exitNs == 0 && waitpid(pid, &status, WNOHANG) == pid) exitNs = monotonicNanoseconds();
+      if(monotonicNanoseconds() > deadline)
+      {
+        kill(pid, SIGKILL);
+        break;
+      }
+
+      struct pollfd pfd = {notify, POLLIN, 0};
+      if(poll(&pfd, 1, exitNs == 0 ? 100 : 0) <= 0)
+      {
+        if(exitNs != 0) break; // The child is gone and no close event is pending
+        continue;
+      }
+      ssize_t const length = read(notify, buffer, sizeof(buffer));
+      std::int64_t const now = monotonicNanoseconds();
+      for(ssize_t offset = 0; offset < length;)
+      {
+        auto const *event = reinterpret_cast<struct inotify_event const *>(buffer + offset);
+        offset += static_cast<ssize_t>(sizeof(struct inotify_event) + event->len);
+        std::string const name = event->len > 0 ? event->name : "";
+        if(name.compare(0, 6, "crash_") != 0 || name.size() < 5 || name.compare(name.size() - 5, 5, ".core") != 0)
+          continue;
+        if((event->mask & IN_MODIFY) != 0 && firstByteNs == 0)
+        {
+          firstByteNs = now;
+          // One event per write() would overflow the queue for large cores
+          watch = inotify_add_watch(notify, options.m_directory.c_str(), IN_CLOSE_WRITE);
+        }
+        if((event->mask & IN_CLOSE_WRITE) != 0) closedNs = now;
+      }
+    }
+    if(exitNs == 0)
+    {
+      while(waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+      exitNs = monotonicNanoseconds();
+    }
+    close(notify);
+    coreBytes = clearDirectory(options.m_directory);
+
+    if(times->m_faultNs == 0 || firstByteNs == 0 || closedNs == 0 || !WIFSIGNALED(status)) return false;
+    firstByteMicroseconds = static_cast<double>(firstByteNs - times->m_faultNs) / 1e3;
+    closedMilliseconds    = static_cast<double>(closedNs - times->m_faultNs) / 1e6;
+    exitMilliseconds      = static_cast<double>(exitNs - times->m_faultNs) / 1e6;
+    return true;
+  }
+
+  std::string
+  measureCrashes(Options const &options, ChildTimes *times, size_t heapMegabytes)
+  {
+    std::vector<double> firstByte;
+    std::vector<double> closed;
+    std::vector<double> exited;
+    unsigned long long coreBytes = 0;
+    for(int run = 0; run < options.m_runs; ++run)
+    {
+      double firstByteMicroseconds = 0;
+      double closedMilliseconds    = 0;
+      double exitMilliseconds      = 0;
+      if(!measureCrash(options, times, heapMegabytes, firstByteMicroseconds, closedMilliseconds, exitMilliseconds,
+                       coreBytes))
+        continue;
+      firstByte.push_back(firstByteMicroseconds);
+      closed.push_back(closedMilliseconds);
+      exited.push_back(exitMilliseconds);
+    }
+    double const coreMegabytes = static_cast<double>(coreBytes) / (1024.0 * 1024.0);
+    Statistics const closedStats = summarize(closed);
+    double const throughput      = closedStats.m_median > 0 ? coreMegabytes / (closedStats.m_median / 1e3) : 0.0;
+    std::fprintf(stderr, "crash %zu MB: %.0f us to first byte, %.1f ms to file closed, %.1f MB/s\n", heapMegabytes,
+                 summarize(firstByte).m_median, closedStats.m_median, throughput);
+
+    char text[128];
+    std::snprintf(text, sizeof(text), ", \"core_mb\": %.1f, \"throughput_mb_s\": %.1f}", coreMegabytes, throughput);
+    return "{\"heap_mb\": " + std::to_string(heapMegabytes) + ", \"samples\": " + std::to_string(closed.size())
+           + ", \"signal_to_first_byte_us\": " + toJson(summarize(firstByte))
+           + ", \"crash_to_file_closed_ms\": " + toJson(closedStats)
+           + ", \"crash_to_exit_ms\": " + toJson(summarize(exited)) + text;
+  }
+
+  std::string
+  measureGenerateDump(Options const &options, size_t heapMegabytes)
+  {
+    size_t const bytes = heapMegabytes * 1024ULL * 1024ULL;
+    char *heap         = allocateHeap(bytes);
+    if(heap == nullptr) return "";
+
+    std::vector<double> latency;
+    unsigned long long coreBytes = 0;
+    for(int run = 0; run < options.m_runs; ++run)
+    {
+      auto const start = std::chrono::steady_clock::now();
+      bool const ok    = CoreDumpGenerator::generateDump("latency benchmark");
+      auto const end   = std::chrono::steady_clock::now();
+      unsigned long long const written = clearDirectory(options.m_directory);
+      if(!ok) continue;
+      latency.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+      coreBytes = written;
+    }
+    munmap(heap, bytes);
+
+    double const coreMegabytes = static_cast<double>(coreBytes) / (1024.0 * 1024.0);
+    Statistics const stats     = summarize(latency);
+    double const throughput    = stats.m_median > 0 ? coreMegabytes / (stats.m_median / 1e3) : 0.0;
+    std::fprintf(stderr, "generateDump %zu MB: %.1f ms, %.1f MB/s\n", heapMegabytes, stats.m_median, throughput);
+
+    char text[128];
+    std::snprintf(text, sizeof(text), ", \"core_mb\": %.1f, \"throughput_mb_s\": %.1f}", coreMegabytes, throughput);
+    return "{\"heap_mb\": " + std::to_string(heapMegabytes) + ", \"samples\": " + std::to_string(latency.size())
+           + ", \"latency_ms\": " + toJson(stats) + text;
+  }
+
+  bool
+  parseOptions(int argc, char **argv, Options &options)
+  {
+    for(int index = 1; index + 1 < argc; index += 2)
+    {
+      std::string const option = argv[index];
+      std::string const value  = argv[index + 1];
+      if(option == "--heap-mb")
+      {
+        options.m_heapMegabytes.clear();
+        for(size_t start = 0; start < value.size();)
+        {
+          size_t end = value.find(',', start);
+          if(end == std::string::npos) end = value.size();
+          std::string const item = value.substr(start, end - start);
+          size_t const megabytes = static_cast<size_t>(std::strtoull(item.c_str(), nullptr, 10));
+          if(megabytes > 0) options.m_heapMegabytes.push_back(megabytes);
+          start = end + 1;
+        }
+      }
+      else if(option == "--runs")
+        options.m_runs = std::max(1, std::atoi(value.c_str()));
+      else if(option == "--dir")
+        options.m_directory = value;
+      else if(option == "--output")
+        options.m_output = value;
+      else
+        return false;
+    }
+    return (argc % 2) != 0;
+  }
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  Options options;
+  if(!parseOptions(argc, argv, options))
+  {
+    std::fprintf(stderr, "Usage: %s [--heap-mb 256,1024,4096,16384] [--runs N] [--dir PATH] [--output FILE]\n",
+                 argv[0]);
+    return 1;
+  }
+
+  bool const temporaryDirectory = options.m_directory.empty();
+  if(temporaryDirectory)
+  {
+    char path[] = "/tmp/CoreDumpGeneratorLatencyXXXXXX";
+    if(mkdtemp(path) == nullptr)
+    {
+      std::fprintf(stderr, "Failed to create a dump directory: %s\n", std::strerror(errno));
+      return 1;
+    }
+    options.m_directory = path;
+  }
+  else
+    mkdir(options.m_directory.c_str(), 0755);
+
+  std::string originalPattern;
+  bool const patternSaved = readCorePattern(originalPattern);
+
+  void *shared = mmap(nullptr, sizeof(ChildTimes), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(shared == MAP_FAILED)
+  {
+    std::fprintf(stderr, "Failed to map shared memory: %s\n", std::strerror(errno));
+    return 1;
+  }
+  ChildTimes *times = new(shared) ChildTimes();
+
+  // Sizes that would swap or fill the disk measure the machine, not the library
+  size_t const memoryLimit = availableMegabytes() * 3 / 4;
+  size_t const diskLimit   = freeDiskMegabytes(options.m_directory);
+  std::vector<size_t> heapSizes;
+  std::vector<std::string> skipped;
+  for(size_t megabytes : options.m_heapMegabytes)
+  {
+    char reason[128] = {};
+    if(memoryLimit > 0 && megabytes > memoryLimit)
+      std::snprintf(reason, sizeof(reason), "exceeds 3/4 of MemAvailable (%zu MB)", memoryLimit);
+    else if(megabytes + 256 > diskLimit)
+      std::snprintf(reason, sizeof(reason), "exceeds free space in the dump directory (%zu MB)", diskLimit);
+    if(reason[0] == '\0')
+      heapSizes.push_back(megabytes);
+    else
+    {
+      std::fprintf(stderr, "Skipping %zu MB: %s\n", megabytes, reason);
+      skipped.push_back("{\"heap_mb\": " + std::to_string(megabytes) + ", \"reason\": " + quoted(reason) + "}");
+    }
+  }
+
+  // Children first: the parent must not have library threads when it forks
+  std::string const deferred    = measureInitialize(options, times, true);
+  std::string const synchronous = measureInitialize(options, times, false);
+  std::vector<std::string> crashes;
+  for(size_t megabytes : heapSizes) crashes.push_back(measureCrashes(options, times, megabytes));
+
+  CoreDumpGenerator::initialize(benchmarkConfiguration(options.m_directory, true));
+  CoreDumpGenerator::waitUntilReady();
+  std::vector<std::string> dumps;
+  for(size_t megabytes : heapSizes)
+  {
+    std::string const result = measureGenerateDump(options, megabytes);
+    if(!result.empty()) dumps.push_back(result);
+  }
+
+  if(patternSaved) writeCorePattern(originalPattern);
+  clearDirectory(options.m_directory);
+  if(temporaryDirectory) rmdir(options.m_directory.c_str());
+
+  struct utsname host;
+  std::string const kernel = uname(&host) == 0 ? std::string(host.release) : std::string();
+  auto const join = [](std::vector<std::string> const &items)
+  {
+    std::string text;
+    for(auto const &item : items) text += (text.empty() ? "\n    " : ",\n    ") + item;
+    return "[" + text + (items.empty() ? "]" : "\n  ]");
+  };
+
+  std::FILE *output = std::fopen(options.m_output.c_str(), "w");
+  if(output == nullptr)
+  {
+    std::fprintf(stderr, "Failed to open %s: %s\n", options.m_output.c_str(), std::strerror(errno));
+    return 1;
+  }
+  std::fprintf(output, "{\n");
+  std::fprintf(output, "  \"benchmark\": \"CoreDumpGeneratorLatencyBenchmark\",\n");
+  std::fprintf(output, "  \"unix_time\": %lld,\n", static_cast<long long>(std::time(nullptr)));
+  std::fprintf(output, "  \"host\": {\"kernel\": %s, \"cpus\": %ld, \"mem_available_mb\": %zu},\n",
+               quoted(kernel).c_str(), sysconf(_SC_NPROCESSORS_ONLN), availableMegabytes());
+  std::fprintf(output, "  \"dump_type\": \"CORE_DUMP_FULL\",\n");
+  std::fprintf(output, "  \"runs\": %d,\n", options.m_runs);
+  std::fprintf(output, "  \"initialize\": {\n    \"deferred\": %s,\n    \"synchronous\": %s\n  },\n", deferred.c_str(),
+               synchronous.c_str());
+  std::fprintf(output, "  \"generate_dump\": %s,\n", join(dumps).c_str());
+  std::fprintf(output, "  \"crash\": %s,\n", join(crashes).c_str());
+  std::fprintf(output, "  \"skipped\": %s\n", join(skipped).c_str());
+  std::fprintf(output, "}\n");
+  std::fclose(output);
+  std::fprintf(stderr, "Results written to %s\n", options.m_output.c_str());
+  return 0;
+}
+
+// NOLINTEND
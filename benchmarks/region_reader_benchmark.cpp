@@ -0,0 +1,202 @@
+// NOLINTBEGIN
+
+// Compares CoreDumpEngine::RegionReader (batched process_vm_readv) with pread()
+// on /proc/self/mem, and the core writer with and without read-ahead.
+//
+// Usage: CoreDumpGeneratorReaderBenchmark [--heap-mb N] [--fragments N]
+//   --heap-mb    Size of the touched heap (default 16384, capped at 3/4 of MemAvailable)
+//   --fragments  Number of separate mappings the heap is split into (default 1)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoreDumpGenerator.hpp"
+
+namespace
+{
+  struct Heap {
+    std::vector<std::pair<char *, size_t>> m_mappings;
+    size_t m_totalBytes = 0;
+  };
+
+  size_t
+  availableMegabytes()
+  {
+    std::FILE *meminfo = std::fopen("/proc/meminfo", "r");
+    if(meminfo == nullptr) return 0;
+    char line[256];
+    unsigned long long kilobytes = 0;
+    while(std::fgets(line, sizeof(line), meminfo) != nullptr)
+      if(std::sscanf(line, "MemAvailable: %llu kB", &kilobytes) == 1) break;
+    std::fclose(meminfo);
+    return static_cast<size_t>(kilobytes / 1024);
+  }
+
+  bool
+  allocateHeap(Heap &heap, size_t totalBytes, size_t fragments)
+  {
+    size_t const pageSize     = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t const fragmentSize = (totalBytes / fragments + pageSize - 1) & ~(pageSize - 1);
+    for(size_t index = 0; index < fragments; ++index)
+    {
+      // A guard page between fragments keeps the kernel from merging the mappings
+      void *memory = mmap(nullptr, fragmentSize + pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if(memory == MAP_FAILED) return false;
+      char *data = static_cast<char *>(memory);
+      mprotect(data + fragmentSize, pageSize, PROT_NONE);
+      for(size_t offset = 0; offset < fragmentSize; offset += pageSize)
+        std::memset(data + offset, static_cast<int>((offset / pageSize) % 251 + 1), pageSize);
+      heap.m_mappings.emplace_back(data, fragmentSize);
+      heap.m_totalBytes += fragmentSize;
+    }
+    return true;
+  }
+
+  bool
+  isHeapRegion(Heap const &heap, CoreDumpEngine::MemoryRegion const &region)
+  {
+    for(auto const &mapping : heap.m_mappings)
+    {
+      auto const start = reinterpret_cast<std::uintptr_t>(mapping.first);
+      if(region.m_start >= start && region.m_end <= start + mapping.second) return true;
+    }
+    return false;
+  }
+
+  void
+  report(char const *name, size_t bytes, std::chrono::steady_clock::duration elapsed, unsigned checksum)
+  {
+    double const seconds   = std::chrono::duration<double>(elapsed).count();
+    double const megabytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+    std::printf("%-34s %10.1f MB %9.3f s %10.1f MB/s  (checksum %02x)\n", name, megabytes, seconds,
+                seconds > 0 ? megabytes / seconds : 0.0, checksum & 0xFFU);
+  }
+
+  void
+  benchmarkPread(Heap const &heap, size_t chunkSize, char const *name)
+  {
+    int fd = open("/proc/self/mem", O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+    {
+      std::printf("%-34s unavailable: %s\n", name, std::strerror(errno));
+      return;
+    }
+    std::vector<char> buffer(chunkSize);
+    unsigned checksum = 0;
+    size_t bytes      = 0;
+    auto const start  = std::chrono::steady_clock::now();
+    for(auto const &mapping : heap.m_mappings)
+    {
+      auto const base = reinterpret_cast<std::uintptr_t>(mapping.first);
+      for(size_t offset = 0; offset < mapping.second; offset += chunkSize)
+      {
+        size_t const length = std::min(chunkSize, mapping.second - offset);
+        ssize_t const read  = pread(fd, buffer.data(), length, static_cast<off_t>(base + offset));
+        if(read <= 0) break;
+        bytes += static_cast<size_t>(read);
+        checksum ^= static_cast<unsigned char>(buffer[0]);
+      }
+    }
+    report(name, bytes, std::chrono::steady_clock::now() - start, checksum);
+    close(fd);
+  }
+
+  void
+  benchmarkRegionReader(Heap const &heap, CoreDumpEngine::MemoryMap const &map)
+  {
+    std::vector<char> buffer(CoreDumpEngine::Constants::COPY_CHUNK_SIZE);
+    CoreDumpEngine::RegionReader reader(getpid(), map.getRegions());
+    unsigned checksum = 0;
+    size_t bytes      = 0;
+    auto const start  = std::chrono::steady_clock::now();
+    for(;;)
+    {
+      size_t const length = reader.read(buffer.data(), buffer.size());
+      if(length == 0) break;
+      bytes += length;
+      checksum ^= static_cast<unsigned char>(buffer[0]);
+    }
+    report("RegionReader (process_vm_readv)", bytes, std::chrono::steady_clock::now() - start, checksum);
+    if(bytes != heap.m_totalBytes || reader.getUnreadableBytes() != 0)
+      std::printf("  WARNING: read %zu of %zu bytes, %llu unreadable\n", bytes, heap.m_totalBytes,
+                  static_cast<unsigned long long>(reader.getUnreadableBytes()));
+  }
+
+  void
+  benchmarkWriter(CoreDumpEngine::MemoryMap const &map, bool compress, bool readAhead, char const *name)
+  {
+    int fd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+    if(fd < 0) return;
+    std::unique_ptr<CoreDumpEngine::OutputSink> sink
+      = CoreDumpEngine::createOutputSink(fd, compress, CompressionCodec::ZSTD, 1, 0, false);
+    if(!sink)
+    {
+      close(fd);
+      return;
+    }
+    CoreDumpEngine::ThreadList threads(1);
+    threads.front().m_tid = CoreDumpEngine::currentThreadId();
+    CoreDumpEngine::CoreDumpStatistics stats;
+    CoreDumpEngine::ElfCoreWriter writer(*sink, getpid());
+    writer.setReadAhead(readAhead);
+    auto const start = std::chrono::steady_clock::now();
+    writer.write(map, threads, stats);
+    report(name, static_cast<size_t>(stats.m_memoryBytes), std::chrono::steady_clock::now() - start, 0);
+    close(fd);
+  }
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  size_t heapMegabytes = 16384;
+  size_t fragments     = 1;
+  for(int index = 1; index + 1 < argc; index += 2)
+  {
+    std::string const option = argv[index];
+    if(option == "--heap-mb")
+      heapMegabytes = static_cast<size_t>(std::strtoull(argv[index + 1], nullptr, 10));
+    else if(option == "--fragments")
+      fragments = std::max<size_t>(1, static_cast<size_t>(std::strtoull(argv[index + 1], nullptr, 10)));
+  }
+
+  size_t const available = availableMegabytes() * 3 / 4;
+  if(available > 0 && heapMegabytes > available)
+  {
+    std::printf("Heap capped at %zu MB (3/4 of MemAvailable) instead of %zu MB\n", available, heapMegabytes);
+    heapMegabytes = available;
+  }
+
+  Heap heap;
+  std::printf("Touching %zu MB in %zu mapping(s)...\n", heapMegabytes, fragments);
+  if(!allocateHeap(heap, heapMegabytes * 1024ULL * 1024ULL, fragments))
+  {
+    std::fprintf(stderr, "Failed to allocate the heap: %s\n", std::strerror(errno));
+    return 1;
+  }
+
+  CoreDumpEngine::MemoryMap map;
+  if(!map.load(getpid()))
+  {
+    std::fprintf(stderr, "Failed to read /proc/self/maps\n");
+    return 1;
+  }
+  for(auto &region : map.getRegions()) region.m_capture = isHeapRegion(heap, region);
+
+  benchmarkPread(heap, static_cast<size_t>(sysconf(_SC_PAGESIZE)), "pread /proc/self/mem (page)");
+  benchmarkPread(heap, CoreDumpEngine::Constants::COPY_CHUNK_SIZE, "pread /proc/self/mem (1MB)");
+  benchmarkRegionReader(heap, map);
+  benchmarkWriter(map, false, false, "ElfCoreWriter -> /dev/null");
+  if(CoreDumpEngine::isCompressionAvailable(CompressionCodec::ZSTD))
+  {
+    benchmarkWriter(map, true, false, "ElfCoreWriter zstd");
+    benchmarkWriter(map, true, true, "ElfCoreWriter zstd + read-ahead");
+  }
+  return 0;
+}
+
+// NOLINTEND
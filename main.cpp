@@ -78,8 +78,11 @@ namespace
 }
 
 int
-main()
+main(int argc, char **argv)
 {
+  // Returns immediately unless this process is a crash helper spawned by initialize()
+  CoreDumpGenerator::runCrashHelper(argc, argv);
+
   std::cout << "=== CoreDumpGenerator Crash Demonstration ===\n";
   std::cout << "Initializing CoreDumpGenerator...\n";
 
@@ -144,11 +147,11 @@ main()
   std::cout << "24. KERNEL_AUTOMATIC_DUMP\n";
   std::cout << "25. KERNEL_ACTIVE_DUMP\n";
 #else
-  std::cout << "1. CORE_DUMP_FULL\n";
-  std::cout << "2. CORE_DUMP_KERNEL_ONLY\n";
-  std::cout << "3. CORE_DUMP_USER_ONLY\n";
+  std::cout << "1. CORE_DUMP_STACK_ONLY\n";
+  std::cout << "2. CORE_DUMP_STACKS_AND_DATA\n";
+  std::cout << "3. CORE_DUMP_HEAP_FILTERED\n";
   std::cout << "4. CORE_DUMP_COMPRESSED\n";
-  std::cout << "5. CORE_DUMP_FILTERED\n";
+  std::cout << "5. CORE_DUMP_FULL\n";
 #endif
 
   std::cout << "0. Exit\n";
@@ -199,7 +202,11 @@ main()
       DumpType::KERNEL_AUTOMATIC_DUMP,                       // 24
       DumpType::KERNEL_ACTIVE_DUMP                           // 25
 #else
-      DumpType::CORE_DUMP_FULL // 1
+      DumpType::CORE_DUMP_STACK_ONLY,      // 1
+      DumpType::CORE_DUMP_STACKS_AND_DATA, // 2
+      DumpType::CORE_DUMP_HEAP_FILTERED,   // 3
+      DumpType::CORE_DUMP_COMPRESSED,      // 4
+      DumpType::CORE_DUMP_FULL             // 5
 #endif
     };
 
@@ -0,0 +1,209 @@
+// NOLINTBEGIN
+
+// Extraction of systemd-coredump files: builds a fake coredump directory with
+// core.<exe>.<uid>.<boot-id>.<pid>.<time>[.zst|.lz4] files and checks that
+//   - an uncompressed core is copied unchanged under the target stem,
+//   - a compressed core is decompressed byte-identical into a sparse file,
+//     or copied with its suffix when decompression is off,
+//   - the PID is parsed from the file name.
+//
+// Usage: CoreDumpGeneratorExtractionTest (exit status 0 on success)
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CoreDumpGenerator.hpp"
+
+namespace
+{
+  int g_failures = 0;
+
+  void
+  check(bool condition, std::string const &what)
+  {
+    if(condition) return;
+    std::fprintf(stderr, "FAILED: %s\n", what.c_str());
+    ++g_failures;
+  }
+
+  bool
+  writeFile(std::string const &path, std::vector<char> const &content)
+  {
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if(file == nullptr) return false;
+    bool const written = std::fwrite(content.data(), 1, content.size(), file) == content.size();
+    return std::fclose(file) == 0 && written;
+  }
+
+  bool
+  readFile(std::string const &path, std::vector<char> &content)
+  {
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if(file == nullptr) return false;
+    content.clear();
+    char buffer[65536];
+    size_t bytesRead = 0;
+    while((bytesRead = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+      content.insert(content.end(), buffer, buffer + bytesRead);
+    std::fclose(file);
+    return true;
+  }
+
+  // A core-like image: data pages separated by long runs of zero pages
+  std::vector<char>
+  makeCoreImage()
+  {
+    size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<char> image(16 * 1024 * 1024, 0);
+    unsigned state = 12345;
+    for(size_t page = 0; page < image.size() / pageSize; ++page)
+    {
+      if(page % 64 >= 8) continue; // 7 of 8 MB stay zero
+      for(size_t offset = 0; offset < pageSize; ++offset)
+      {
+        state                           = state * 1103515245U + 12345U;
+        image[page * pageSize + offset] = static_cast<char>(state >> 16);
+      }
+    }
+    return image;
+  }
+
+  void
+  checkExtraction(std::string const &name, std::string const &source, std::string const &target, bool decompress,
+                  bool expectDecompressed, std::string const &expectedPath, std::vector<char> const &expected)
+  {
+    CoreDumpEngine::ExtractionStatistics stats;
+    check(CoreDumpEngine::extractSystemdCore(source, target, decompress, stats), name + ": extraction succeeds");
+    check(stats.m_path == expectedPath, name + ": written to " + expectedPath + ", got " + stats.m_path);
+    check(stats.m_decompressed == expectDecompressed, name + ": decompressed flag");
+    check(access((expectedPath + ".partial").c_str(), F_OK) != 0, name + ": no .partial file left");
+
+    std::vector<char> content;
+    check(readFile(expectedPath, content), name + ": output readable");
+    check(content == expected, name + ": output byte-identical");
+    check(stats.m_outputBytes == expected.size(), name + ": output byte count");
+
+    if(expectDecompressed)
+    {
+      struct stat outputStat;
+      check(stat(expectedPath.c_str(), &outputStat) == 0, name + ": stat output");
+      std::uint64_t const allocated = static_cast<std::uint64_t>(outputStat.st_blocks) * 512;
+      check(stats.m_holeBytes > 0, name + ": zero pages reported as holes");
+      check(allocated < expected.size() / 2, name + ": output is sparse (" + std::to_string(allocated) + " bytes)");
+    }
+  }
+
+  void
+  testPidParsing()
+  {
+    struct Case {
+      char const *m_name;
+      char const *m_pid; // nullptr: not a systemd-coredump name
+    };
+    Case const cases[] = {
+      {"core.app.1000.0123456789abcdef0123456789abcdef.4242.1700000000000000", "4242"},
+      {"core.app.1000.0123456789abcdef0123456789abcdef.4242.1700000000000000.zst", "4242"},
+      {"core.app.1000.0123456789abcdef0123456789abcdef.77.1700000000000000.lz4", "77"},
+      {"core.app.1000.0123456789abcdef0123456789abcdef.9.1700000000000000.xz", "9"},
+      {"core.my.dotted.app.0.b.31337.1.zst", "31337"},
+      {"core.app", nullptr},
+      {"core.app.1000.boot.pid.1700000000000000", nullptr},
+      {"core.app.1000.boot.4242.time.zst", nullptr},
+    };
+    for(Case const &testCase : cases)
+    {
+      std::string pid;
+      bool const parsed = CoreDumpEngine::parseSystemdCorePid(testCase.m_name, pid);
+      if(testCase.m_pid == nullptr)
+        check(!parsed, std::string("PID: rejects ") + testCase.m_name);
+      else
+        check(parsed && pid == testCase.m_pid, std::string("PID: ") + testCase.m_pid + " from " + testCase.m_name);
+    }
+  }
+} // namespace
+
+int
+main()
+{
+  char directoryTemplate[] = "/tmp/cdg_extraction_test_XXXXXX";
+  if(mkdtemp(directoryTemplate) == nullptr)
+  {
+    std::perror("mkdtemp");
+    return EXIT_FAILURE;
+  }
+  std::string const directory         = directoryTemplate;
+  std::string const coredumpDirectory = directory + "/coredump";
+  std::string const outputDirectory   = directory + "/out";
+  mkdir(coredumpDirectory.c_str(), 0700);
+  mkdir(outputDirectory.c_str(), 0700);
+  std::string const stem = "core.app.1000.0123456789abcdef0123456789abcdef.4242.1700000000000000";
+
+  testPidParsing();
+
+  std::vector<char> const image = makeCoreImage();
+  std::vector<std::string> created;
+
+  // Uncompressed: copied, name ends in the numeric timestamp so no suffix is kept
+  std::string const plainSource = coredumpDirectory + "/" + stem;
+  check(writeFile(plainSource, image), "write uncompressed source");
+  checkExtraction("copy", plainSource, outputDirectory + "/copy", true, false, outputDirectory + "/copy", image);
+  created.push_back(plainSource);
+  created.push_back(outputDirectory + "/copy");
+
+#if CORE_DUMP_GENERATOR_HAS_ZSTD
+  {
+    std::vector<char> compressed(ZSTD_compressBound(image.size()));
+    size_t const compressedSize = ZSTD_compress(compressed.data(), compressed.size(), image.data(), image.size(), 3);
+    check(!ZSTD_isError(compressedSize), "zstd: compress source");
+    compressed.resize(ZSTD_isError(compressedSize) ? 0 : compressedSize);
+    std::string const source = coredumpDirectory + "/" + stem + ".zst";
+    check(writeFile(source, compressed), "zstd: write source");
+    checkExtraction("zstd decompress", source, outputDirectory + "/zstd", true, true, outputDirectory + "/zstd", image);
+    checkExtraction("zstd copy", source, outputDirectory + "/zstd_copy", false, false,
+                    outputDirectory + "/zstd_copy.zst", compressed);
+    created.push_back(source);
+    created.push_back(outputDirectory + "/zstd");
+    created.push_back(outputDirectory + "/zstd_copy.zst");
+  }
+#else
+  std::printf("zstd not compiled in: decompression of .zst cores not tested\n");
+#endif
+
+#if CORE_DUMP_GENERATOR_HAS_LZ4
+  {
+    std::vector<char> compressed(LZ4F_compressFrameBound(image.size(), nullptr));
+    size_t const compressedSize
+      = LZ4F_compressFrame(compressed.data(), compressed.size(), image.data(), image.size(), nullptr);
+    check(!LZ4F_isError(compressedSize), "lz4: compress source");
+    compressed.resize(LZ4F_isError(compressedSize) ? 0 : compressedSize);
+    std::string const source = coredumpDirectory + "/" + stem + ".lz4";
+    check(writeFile(source, compressed), "lz4: write source");
+    checkExtraction("lz4 decompress", source, outputDirectory + "/lz4", true, true, outputDirectory + "/lz4", image);
+    created.push_back(source);
+    created.push_back(outputDirectory + "/lz4");
+  }
+#else
+  std::printf("LZ4 not compiled in: decompression of .lz4 cores not tested\n");
+#endif
+
+  for(auto const &path : created) unlink(path.c_str());
+  rmdir(coredumpDirectory.c_str());
+  rmdir(outputDirectory.c_str());
+  rmdir(directory.c_str());
+
+  if(g_failures > 0)
+  {
+    std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+    return EXIT_FAILURE;
+  }
+  std::printf("All systemd-coredump extraction checks passed\n");
+  return EXIT_SUCCESS;
+}
+
+// NOLINTEND
@@ -0,0 +1,17 @@
+// Kernel core_pattern pipe helper.
+//
+// initialize() with DumpConfiguration::setCorePatternHelperPath() pointing at
+// this binary sets core_pattern to
+//   |<helper> <directory> <codec>[:<level>]|none %t %p %s %u %g %e
+// The kernel then streams each core to stdin; the helper stores it
+// compressed in parallel or sparse, and writes a <stem>.json metadata file.
+
+#include <cstdlib>
+
+#include "CoreDumpGenerator.hpp"
+
+int
+main(int argc, char **argv)
+{
+  return CoreDumpGenerator::runCorePatternHelper(argc, argv) ? EXIT_SUCCESS : EXIT_FAILURE;
+}